@@ -2,6 +2,15 @@
 #define ARRAY_H
 
 #include <iostream>
+#include <vector>
+#include <cassert>
+#include <climits>
+#include <new>
+#include <utility>
+#include <cstring>
+#include <type_traits>
+#include "arraysimd.h"
+#include "arrayallocator.h"
 using namespace std;
 
 //---------------------------------------------------------------------------
@@ -12,15 +21,35 @@ using namespace std;
 //   -- allows for assignment of 2 arrays
 //   -- size is part of the class (so no longer needs to be passed)
 //   -- includes range checking, program terminates for out-of-bound subscripts
+//   -- contains, getFrequencyOf, findFirst, getMin and getMax scan the
+//      items with ArrayScan, SIMD kernels for 4 and 8 byte numeric types
+//   -- grows: pushBack and emplaceBack add an item at the end, resize
+//      changes the size, reserve and shrinkToFit manage the capacity
 //
 // Assumptions:
-//   -- size defaults to a fixed size of 10 if size is not specified
+//   -- size defaults to 0 if size is not specified
 //   -- in <<, display 10 per line
+//   -- storage is allocated raw, capacity items at a time, and items are
+//      constructed in it only up to size; items made by the constructor are
+//      default-initialized like new ItemType[n], items added by resize are
+//      value-initialized (0 for numbers)
+//   -- when an item is added to a full array the capacity doubles, to at
+//      least DEFAULT_CAPCITY, so n pushBacks move O(n) items in total; items
+//      are moved to the new storage when their move cannot throw, copied
+//      otherwise
+//   -- operator= reuses the current storage when it is large enough
+//   -- storage comes from the Allocator policy (arrayallocator.h), by
+//      default AlignedAllocator<64>: cache-line aligned, so SIMD scans
+//      start on a line; HugePageAllocator backs large arrays with huge pages
+//   -- trivial items are not touched by the constructor (their values are
+//      indeterminate, like new ItemType[n]), and trivially copyable items
+//      are copied and moved with memcpy
+//   -- a moved-from Array is empty
 //---------------------------------------------------------------------------
 
-template <typename ItemType>
+template <typename ItemType, typename Allocator = AlignedAllocator<> >
 class Array {
-friend ostream& operator<<(ostream &output, const Array<ItemType> &a) {
+friend ostream& operator<<(ostream &output, const Array &a) {
    int i;
    for (i = 0; i < a.arraySize; i++) {
       output << a.items[i] << ' ';
@@ -31,7 +60,7 @@ friend ostream& operator<<(ostream &output, const Array<ItemType> &a) {
    if (i % 10 != 0) output << endl;
    return output;                      // e.g., enables cout << x << y;
 }
-friend istream& operator>>(istream &input, Array<ItemType> &a) {
+friend istream& operator>>(istream &input, Array &a) {
    for (int i = 0; i < a.arraySize; i++)
       input >> a.items[i];
    return input;                        // e.g., enables cin >> x >> y;
@@ -39,17 +68,37 @@ friend istream& operator>>(istream &input, Array<ItemType> &a) {
 public:
    Array(int = 0);            // default constructor
    Array(const Array&);       // copy constructor
+   Array(Array&&) noexcept;   // move constructor
    ~Array();                  // destructor
    
    // overloaded operators
-   const Array<ItemType>& operator=(const Array&);    // assign Array objects
+   const Array& operator=(const Array&);     // assign Array objects
+   Array& operator=(Array&&) noexcept;       // move Array objects
    bool operator==(const Array&) const;      // equality, arrays are identical
    bool operator!=(const Array&) const;      // inequality, array are unequal
    ItemType& operator[](int);                // subscript operator, mutator
    const ItemType& operator[](int) const;    // subscript operator, accessor
    
    // return size of array
-   int size();
+   int size() const;
+   
+   // number of items the array holds before it has to grow
+   int capacity() const;
+   
+   // add an item at the end, growing the array when it is full
+   void pushBack(const ItemType& anEntry);
+   void pushBack(ItemType&& anEntry);
+   template <typename... Args>
+   void emplaceBack(Args&&... args);
+   
+   // room for at least newCapacity items without growing again
+   void reserve(int newCapacity);
+   
+   // change the size, new items are value-initialized
+   void resize(int newSize);
+   
+   // release capacity beyond the size
+   void shrinkToFit();
    
    // returns true if array contains anEntry
    bool contains(const ItemType& anEntry) const;
@@ -57,67 +106,182 @@ public:
    // return the frequency of a anEntry
    int getFrequencyOf(const ItemType& anEntry) const;
    
+   // returns the subscript of the first anEntry, -1 if there is none
+   int findFirst(const ItemType& anEntry) const;
+   
+   // return the smallest and largest item, array must not be empty
+   ItemType getMin() const;
+   ItemType getMax() const;
+   
    // converts this object to a vector
    vector<ItemType> toVector() const;
    
 private:
+   static_assert(Allocator::ALIGNMENT % alignof(ItemType) == 0,
+                 "Allocator alignment is too small for ItemType");
    static const int DEFAULT_CAPCITY = 100;
    ItemType* items;              // array to hold objects of ItemType
    int arraySize;                // number of items in the array
+   int arrayCapacity;            // number of items items has room for
    
    void copy(const Array&);      // copy constructor and operator= helper
+   
+   // raw storage for a number of items, nothing is constructed
+   static ItemType* allocate(int);
+   static void deallocate(ItemType*, int);
+   void destroyFrom(int);        // destroys items from a subscript to size
+   void relocate(ItemType*);     // moves the items to other raw storage
+   
+   // moves the items to storage for newCapacity items
+   void reallocate(int newCapacity);
+   int grownCapacity(int) const; // capacity for at least a number of items
 };
 
 //------------------------------ Constructor ----------------------------------
 // Default constructor for class Array
-template <typename ItemType>
-Array<ItemType>::Array(int arrSize): arraySize(arrSize) {
-   items = new ItemType[arrSize];
+template <typename ItemType, typename Allocator>
+Array<ItemType, Allocator>::Array(int arrSize): arraySize(arrSize), arrayCapacity(arrSize) {
+   assert(arrSize >= 0);
+   items = allocate(arrSize);
+   // trivial items are left as they are, so fresh storage is not written
+   if(!is_trivially_default_constructible<ItemType>::value) {
+      for(int i = 0; i < arrSize; i++) {
+         new (items + i) ItemType;
+      }
+   }
 }
 
 //------------------------------- Destructor ----------------------------------
-template <typename ItemType>
-Array<ItemType>::~Array() {
-   delete [] items;
+template <typename ItemType, typename Allocator>
+Array<ItemType, Allocator>::~Array() {
+   destroyFrom(0);
+   deallocate(items, arrayCapacity);
 }
 
 //--------------------------- Copy Constructor --------------------------------
 // Copy constructor for class Array
-template <typename ItemType>
-Array<ItemType>::Array(const Array<ItemType>& right) {
+template <typename ItemType, typename Allocator>
+Array<ItemType, Allocator>::Array(const Array& right) {
+   items = allocate(right.arraySize);
+   arraySize = 0;
+   arrayCapacity = right.arraySize;
    copy(right);
 }
 
+//--------------------------- Move Constructor --------------------------------
+// takes the storage of right, which is left empty
+template <typename ItemType, typename Allocator>
+Array<ItemType, Allocator>::Array(Array&& right) noexcept
+   : items(right.items), arraySize(right.arraySize),
+     arrayCapacity(right.arrayCapacity) {
+   right.items = nullptr;
+   right.arraySize = 0;
+   right.arrayCapacity = 0;
+}
+
 //---------------------------- Copy -------------------------------------------
-// Copy constructor for class Array
-template <typename ItemType>
-void Array<ItemType>::copy(const Array<ItemType>& right) {
-   arraySize = right.arraySize;
-   items = new ItemType[arraySize];
-   assert(items != nullptr);
-   
-   for(int i = 0; i < arraySize; i++) {
+// makes the items equal to right's in the current storage, which has room
+// for them: existing items are assigned, missing ones copy-constructed and
+// extra ones destroyed
+template <typename ItemType, typename Allocator>
+void Array<ItemType, Allocator>::copy(const Array& right) {
+   assert(arrayCapacity >= right.arraySize);
+   if(is_trivially_copyable<ItemType>::value) {
+      if(right.arraySize > 0) {
+         memcpy(static_cast<void*>(items), right.items,
+                right.arraySize * sizeof(ItemType));
+      }
+      arraySize = right.arraySize;
+      return;
+   }
+   int common = arraySize < right.arraySize ? arraySize : right.arraySize;
+   for(int i = 0; i < common; i++) {
       items[i] = right.items[i];
    }
-   
+   for(int i = common; i < right.arraySize; i++) {
+      new (items + i) ItemType(right.items[i]);
+      arraySize = i + 1;
+   }
+   destroyFrom(right.arraySize);
 }
 
 //---------------------------- operator= --------------------------------------
-// Overloaded operator= for class Array
-template <typename ItemType>
-const Array<ItemType>& Array<ItemType>::operator=(const Array<ItemType>& right) {
+// Overloaded operator= for class Array, storage is only replaced when it is
+// too small for right's items
+template <typename ItemType, typename Allocator>
+const Array<ItemType, Allocator>&
+Array<ItemType, Allocator>::operator=(const Array& right) {
    if(this != &right) {
-      delete [] items;
+      if(arrayCapacity < right.arraySize) {
+         destroyFrom(0);
+         deallocate(items, arrayCapacity);
+         items = allocate(right.arraySize);
+         arrayCapacity = right.arraySize;
+      }
       copy(right);
    }
    return *this;
 }
 
+//---------------------------- operator= --------------------------------------
+// move assignment, frees the current items and takes right's storage
+template <typename ItemType, typename Allocator>
+Array<ItemType, Allocator>&
+Array<ItemType, Allocator>::operator=(Array&& right) noexcept {
+   if(this != &right) {
+      destroyFrom(0);
+      deallocate(items, arrayCapacity);
+      items = right.items;
+      arraySize = right.arraySize;
+      arrayCapacity = right.arrayCapacity;
+      right.items = nullptr;
+      right.arraySize = 0;
+      right.arrayCapacity = 0;
+   }
+   return *this;
+}
+
+//---------------------------- allocate ---------------------------------------
+// raw storage for count items from Allocator, nullptr for none
+template <typename ItemType, typename Allocator>
+ItemType* Array<ItemType, Allocator>::allocate(int count) {
+   if(count == 0) {
+      return nullptr;
+   }
+   return static_cast<ItemType*>(Allocator::allocate(count * sizeof(ItemType)));
+}
+
+//---------------------------- deallocate -------------------------------------
+// returns storage allocated for count items
+template <typename ItemType, typename Allocator>
+void Array<ItemType, Allocator>::deallocate(ItemType* storage, int count) {
+   if(storage != nullptr) {
+      Allocator::deallocate(storage, count * sizeof(ItemType));
+   }
+}
+
+//---------------------------- destroyFrom ------------------------------------
+// destroys the items from subscript first to the end, size becomes first
+template <typename ItemType, typename Allocator>
+void Array<ItemType, Allocator>::destroyFrom(int first) {
+   if(!is_trivially_destructible<ItemType>::value) {
+      for(int i = first; i < arraySize; i++) {
+         items[i].~ItemType();
+      }
+   }
+   if(first < arraySize) {
+      arraySize = first;
+   }
+}
+
 //------------------------------  ==  -----------------------------------------
 // Determine if two arrays are equal.
 // The type or object ItemType has responsibility for overloading operator!=
-template <typename ItemType>
-bool Array<ItemType>::operator==(const Array& right) const {
+template <typename ItemType, typename Allocator>
+bool Array<ItemType, Allocator>::operator==(const Array& right) const {
+   if(arraySize != right.arraySize) {
+      return false;
+   }
    for(int i = 0; i < arraySize; i++) {
       if(items[i] != right.items[i]) {
          return false;
@@ -128,8 +292,8 @@ bool Array<ItemType>::operator==(const Array& right) const {
 
 //--------------------------------  !=  ---------------------------------------
 // Determine if two arrays are not equal.
-template <typename ItemType>
-bool Array<ItemType>::operator!=(const Array& right) const {
+template <typename ItemType, typename Allocator>
+bool Array<ItemType, Allocator>::operator!=(const Array& right) const {
    return !(*this == right);
 }
 
@@ -137,8 +301,8 @@ bool Array<ItemType>::operator!=(const Array& right) const {
 // [] mutator
 // Overloaded subscript operator, mutator
 // terminates if subscript out of range error
-template <typename ItemType>
-ItemType& Array<ItemType>::operator[](int subscript) {
+template <typename ItemType, typename Allocator>
+ItemType& Array<ItemType, Allocator>::operator[](int subscript) {
    assert(0 <= subscript && subscript < arraySize);
    return items[subscript];
 }
@@ -147,8 +311,8 @@ ItemType& Array<ItemType>::operator[](int subscript) {
 // [] accessor
 // Overloaded subscript operator, accessor
 // terminates if subscript out of range error
-template <typename ItemType>
-const ItemType& Array<ItemType>::operator[](int subscript) const {
+template <typename ItemType, typename Allocator>
+const ItemType& Array<ItemType, Allocator>::operator[](int subscript) const {
    // assert that the test is true, program terminates if false
    assert(0 <= subscript && subscript < arraySize);
    return items[subscript];
@@ -156,43 +320,174 @@ const ItemType& Array<ItemType>::operator[](int subscript) const {
 
 // ------------------------------ size ----------------------------------------
 // return the size of the array (number of elements in array, not bit size)
-template <typename ItemType>
-int Array<ItemType>::size() {
+template <typename ItemType, typename Allocator>
+int Array<ItemType, Allocator>::size() const {
    return arraySize;
 }
 
-// ---------------------------- contains --------------------------------------
-// returns true if array contains anEntry; return false otherwise
-template <typename ItemType>
-bool Array<ItemType>::contains(const ItemType& anEntry) const {
-   for(int i = 0; i < arraySize; i++) {
-      if(items[i] == anEntry) {
-         return true;
+// ---------------------------- capacity --------------------------------------
+// return the number of items the storage has room for
+template <typename ItemType, typename Allocator>
+int Array<ItemType, Allocator>::capacity() const {
+   return arrayCapacity;
+}
+
+// --------------------------- grownCapacity ----------------------------------
+// doubles the capacity, starting from DEFAULT_CAPCITY, until it holds needed;
+// past INT_MAX / 2 it goes to INT_MAX, the most items an Array can hold
+template <typename ItemType, typename Allocator>
+int Array<ItemType, Allocator>::grownCapacity(int needed) const {
+   assert(needed >= 0);
+   int grown = arrayCapacity < DEFAULT_CAPCITY ? DEFAULT_CAPCITY :
+               arrayCapacity > INT_MAX / 2     ? INT_MAX
+                                               : 2 * arrayCapacity;
+   return grown < needed ? needed : grown;
+}
+
+// ---------------------------- reallocate ------------------------------------
+// moves the items to new storage with room for newCapacity items, copying
+// them instead when their move constructor may throw
+template <typename ItemType, typename Allocator>
+void Array<ItemType, Allocator>::reallocate(int newCapacity) {
+   assert(newCapacity >= arraySize);
+   ItemType* fresh = allocate(newCapacity);
+   relocate(fresh);
+   deallocate(items, arrayCapacity);
+   items = fresh;
+   arrayCapacity = newCapacity;
+}
+
+// ----------------------------- relocate -------------------------------------
+// moves the items to fresh, raw storage with room for them, and destroys
+// them here; the size is unchanged. Trivially copyable items are copied
+// with memcpy.
+template <typename ItemType, typename Allocator>
+void Array<ItemType, Allocator>::relocate(ItemType* fresh) {
+   if(is_trivially_copyable<ItemType>::value) {
+      if(arraySize > 0) {
+         memcpy(static_cast<void*>(fresh), items,
+                arraySize * sizeof(ItemType));
       }
+      return;
+   }
+   for(int i = 0; i < arraySize; i++) {
+      new (fresh + i) ItemType(move_if_noexcept(items[i]));
+   }
+   int count = arraySize;
+   destroyFrom(0);
+   arraySize = count;
+}
+
+// ----------------------------- reserve --------------------------------------
+// grows the storage to at least newCapacity items, never shrinks it
+template <typename ItemType, typename Allocator>
+void Array<ItemType, Allocator>::reserve(int newCapacity) {
+   if(newCapacity > arrayCapacity) {
+      reallocate(newCapacity);
+   }
+}
+
+// ---------------------------- shrinkToFit -----------------------------------
+// storage for exactly size items
+template <typename ItemType, typename Allocator>
+void Array<ItemType, Allocator>::shrinkToFit() {
+   if(arrayCapacity > arraySize) {
+      reallocate(arraySize);
+   }
+}
+
+// ----------------------------- resize ---------------------------------------
+// destroys items past newSize or adds value-initialized ones up to it
+template <typename ItemType, typename Allocator>
+void Array<ItemType, Allocator>::resize(int newSize) {
+   assert(newSize >= 0);
+   if(newSize > arrayCapacity) {
+      reallocate(grownCapacity(newSize));
+   }
+   for(int i = arraySize; i < newSize; i++) {
+      new (items + i) ItemType();
+      arraySize = i + 1;
+   }
+   destroyFrom(newSize);
+}
+
+// ---------------------------- emplaceBack -----------------------------------
+// constructs an item at the end from args; when the array is full the new
+// item is constructed in the new storage before the old items move, so
+// args may refer to an item of this array
+template <typename ItemType, typename Allocator>
+template <typename... Args>
+void Array<ItemType, Allocator>::emplaceBack(Args&&... args) {
+   assert(arraySize < INT_MAX);
+   if(arraySize < arrayCapacity) {
+      new (items + arraySize) ItemType(std::forward<Args>(args)...);
+      arraySize++;
+      return;
    }
-   return false;
+   int newCapacity = grownCapacity(arraySize + 1);
+   ItemType* fresh = allocate(newCapacity);
+   new (fresh + arraySize) ItemType(std::forward<Args>(args)...);
+   relocate(fresh);
+   deallocate(items, arrayCapacity);
+   items = fresh;
+   arraySize++;
+   arrayCapacity = newCapacity;
 }
+
+// ----------------------------- pushBack -------------------------------------
+// adds a copy of anEntry, or moves it in, at the end
+template <typename ItemType, typename Allocator>
+void Array<ItemType, Allocator>::pushBack(const ItemType& anEntry) {
+   emplaceBack(anEntry);
+}
+
+template <typename ItemType, typename Allocator>
+void Array<ItemType, Allocator>::pushBack(ItemType&& anEntry) {
+   emplaceBack(std::move(anEntry));
+}
+
+// ---------------------------- contains --------------------------------------
+// returns true if array contains anEntry; return false otherwise
+template <typename ItemType, typename Allocator>
+bool Array<ItemType, Allocator>::contains(const ItemType& anEntry) const {
+   return ArrayScan<ItemType>::findFirst(items, arraySize, anEntry) >= 0;
+}
+
 // --------------------------- getFrequencyOf ---------------------------------
 // return the frequency of a anEntry
-template <typename ItemType>
-int Array<ItemType>::getFrequencyOf(const ItemType& anEntry) const {
-   int counter = 0;
-   for(int i = 0; i < arraySize; i++) {
-      if(items[i] == anEntry) {
-         counter++;
-      }
-   }
+template <typename ItemType, typename Allocator>
+int Array<ItemType, Allocator>::getFrequencyOf(const ItemType& anEntry) const {
+   return ArrayScan<ItemType>::count(items, arraySize, anEntry);
+}
+
+// ---------------------------- findFirst -------------------------------------
+// returns the subscript of the first item equal to anEntry, -1 if none is
+template <typename ItemType, typename Allocator>
+int Array<ItemType, Allocator>::findFirst(const ItemType& anEntry) const {
+   return ArrayScan<ItemType>::findFirst(items, arraySize, anEntry);
+}
+
+// ----------------------------- getMin ---------------------------------------
+// return the smallest item, terminates if the array is empty
+template <typename ItemType, typename Allocator>
+ItemType Array<ItemType, Allocator>::getMin() const {
+   assert(arraySize > 0);
+   return ArrayScan<ItemType>::min(items, arraySize);
+}
+
+// ----------------------------- getMax ---------------------------------------
+// return the largest item, terminates if the array is empty
+template <typename ItemType, typename Allocator>
+ItemType Array<ItemType, Allocator>::getMax() const {
+   assert(arraySize > 0);
+   return ArrayScan<ItemType>::max(items, arraySize);
 }
 
 // ---------------------------- toVector --------------------------------------
 // converts this object to a vector
-template <typename ItemType>
-vector<ItemType> Array<ItemType>::toVector() const {
-   vector<ItemType> v;
-   for(int i = 0; i < arraySize; i++) {
-      v.push_back(items[i]);
-   }
-   return v;
+template <typename ItemType, typename Allocator>
+vector<ItemType> Array<ItemType, Allocator>::toVector() const {
+   return vector<ItemType>(items, items + arraySize);
 }
 
 #endif
@@ -0,0 +1,119 @@
+#ifndef ARRAYALLOCATOR_H
+#define ARRAYALLOCATOR_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#endif
+using namespace std;
+
+//---------------------------------------------------------------------------
+// Array allocators:  where an Array gets its raw storage
+//   -- an allocator is a class with
+//        static const size_t ALIGNMENT;
+//        static void* allocate(size_t bytes);
+//        static void deallocate(void* storage, size_t bytes);
+//      deallocate gets the same number of bytes allocate was called with,
+//      and Array only calls allocate with bytes > 0
+//   -- AlignedAllocator<Alignment> returns storage aligned to Alignment
+//      bytes, any power of two that is a multiple of sizeof(void*); the
+//      default 64 is a cache line and the width of an AVX-512 load
+//   -- HugePageAllocator<Alignment> maps buffers of HUGE_PAGE bytes or more
+//      straight from the system, on Linux with huge pages (MAP_HUGETLB) when
+//      some are reserved and otherwise asking for transparent huge pages;
+//      smaller buffers come from AlignedAllocator; Alignment is at most
+//      4096, the page size mapped buffers are sure to be aligned to
+//
+// Assumptions:
+//   -- both throw bad_alloc when no memory is left
+//   -- mapped memory starts zeroed and untouched, pages are only backed
+//      when first written
+//---------------------------------------------------------------------------
+
+template <size_t Alignment = 64>
+class AlignedAllocator {
+public:
+   static const size_t ALIGNMENT = Alignment;
+
+   static void* allocate(size_t bytes) {
+      static_assert((Alignment & (Alignment - 1)) == 0 &&
+                    Alignment % sizeof(void*) == 0,
+                    "Alignment must be a power of two and a multiple of "
+                    "sizeof(void*)");
+      void* storage = nullptr;
+#if defined(__unix__) || defined(__APPLE__)
+      if(posix_memalign(&storage, Alignment, bytes) != 0) {
+         throw bad_alloc();
+      }
+#else
+      storage = _aligned_malloc(bytes, Alignment);
+      if(storage == nullptr) {
+         throw bad_alloc();
+      }
+#endif
+      return storage;
+   }
+
+   static void deallocate(void* storage, size_t) {
+#if defined(__unix__) || defined(__APPLE__)
+      free(storage);
+#else
+      _aligned_free(storage);
+#endif
+   }
+};
+
+template <size_t Alignment = 64>
+class HugePageAllocator {
+   static_assert(Alignment <= 4096,
+                 "mapped buffers are only aligned to a 4 KiB page");
+public:
+   static const size_t ALIGNMENT = Alignment;
+   static const size_t HUGE_PAGE = 2 * 1024 * 1024;  // x86-64 huge page
+
+   static void* allocate(size_t bytes) {
+#if defined(__unix__) || defined(__APPLE__)
+      if(bytes >= HUGE_PAGE) {
+         size_t length = roundUp(bytes);
+         void* storage = MAP_FAILED;
+#ifdef MAP_HUGETLB
+         storage = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+         if(storage == MAP_FAILED) {
+            // no reserved huge pages, let the kernel merge normal ones
+            storage = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if(storage == MAP_FAILED) {
+               throw bad_alloc();
+            }
+#ifdef MADV_HUGEPAGE
+            madvise(storage, length, MADV_HUGEPAGE);
+#endif
+         }
+         return storage;
+      }
+#endif
+      return AlignedAllocator<Alignment>::allocate(bytes);
+   }
+
+   static void deallocate(void* storage, size_t bytes) {
+#if defined(__unix__) || defined(__APPLE__)
+      if(bytes >= HUGE_PAGE) {
+         munmap(storage, roundUp(bytes));
+         return;
+      }
+#endif
+      AlignedAllocator<Alignment>::deallocate(storage, bytes);
+   }
+
+private:
+   // whole huge pages, munmap of a MAP_HUGETLB mapping needs them
+   static size_t roundUp(size_t bytes) {
+      return (bytes + HUGE_PAGE - 1) / HUGE_PAGE * HUGE_PAGE;
+   }
+};
+
+#endif
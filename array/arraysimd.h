@@ -0,0 +1,516 @@
+#ifndef ARRAYSIMD_H
+#define ARRAYSIMD_H
+
+#include <cstdint>
+#include <type_traits>
+using namespace std;
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ARRAY_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+// highest instruction set the kernels may use: 2 AVX2, 1 SSE4.2, 0 none
+#ifndef ARRAY_SIMD_MAX_LEVEL
+#define ARRAY_SIMD_MAX_LEVEL 2
+#endif
+
+//---------------------------------------------------------------------------
+// ArrayScan class:  the search loops used by Array
+//   -- findFirst, count, min and max over a plain C array of n items
+//   -- ArrayScan<ItemType> picks its version from ItemType at compile time:
+//      4 and 8 byte integer and floating point types get SIMD kernels,
+//      every other type gets plain loops using == and <
+//   -- the SIMD kernels compare 32 bytes at a time with AVX2 or 16 with
+//      SSE4.2; which one runs is decided once, at the first call, from
+//      what the processor supports, and a processor with neither (or a
+//      build for another architecture) uses the plain loops
+//   -- the SIMD versions take an optional level, at most simdLevel(), to
+//      run a lower instruction set's kernels on the same processor
+//
+// Assumptions:
+//   -- min and max are called with n > 0
+//   -- float and double compare with == like the plain loop does, so NaN
+//      is never found and -0.0 finds 0.0; min and max of an array holding
+//      a NaN are unspecified
+//---------------------------------------------------------------------------
+
+// kind of SIMD lane an item type maps to
+enum ScanKind { SCAN_NONE, SCAN_I32, SCAN_U32, SCAN_I64, SCAN_U64,
+                SCAN_F32, SCAN_F64 };
+
+template <typename ItemType>
+struct ScanKindOf {
+#ifdef ARRAY_SIMD_X86
+   static const int value =
+      is_same<ItemType, bool>::value ? SCAN_NONE :
+      is_integral<ItemType>::value && sizeof(ItemType) == 4 ?
+         (is_signed<ItemType>::value ? SCAN_I32 : SCAN_U32) :
+      is_integral<ItemType>::value && sizeof(ItemType) == 8 ?
+         (is_signed<ItemType>::value ? SCAN_I64 : SCAN_U64) :
+      is_same<ItemType, float>::value ? SCAN_F32 :
+      is_same<ItemType, double>::value ? SCAN_F64 : SCAN_NONE;
+#else
+   static const int value = SCAN_NONE;
+#endif
+};
+
+//------------------------------ ArrayScan ------------------------------------
+// plain loops, used for every type without SIMD kernels and for the items
+// left over after the last full vector
+template <typename ItemType, int Kind = ScanKindOf<ItemType>::value>
+struct ArrayScan {
+   static int findFirst(const ItemType* items, int n, const ItemType& key) {
+      for(int i = 0; i < n; i++) {
+         if(items[i] == key) {
+            return i;
+         }
+      }
+      return -1;
+   }
+
+   static int count(const ItemType* items, int n, const ItemType& key) {
+      int counter = 0;
+      for(int i = 0; i < n; i++) {
+         if(items[i] == key) {
+            counter++;
+         }
+      }
+      return counter;
+   }
+
+   static ItemType min(const ItemType* items, int n) {
+      ItemType best = items[0];
+      for(int i = 1; i < n; i++) {
+         if(items[i] < best) {
+            best = items[i];
+         }
+      }
+      return best;
+   }
+
+   static ItemType max(const ItemType* items, int n) {
+      ItemType best = items[0];
+      for(int i = 1; i < n; i++) {
+         if(best < items[i]) {
+            best = items[i];
+         }
+      }
+      return best;
+   }
+};
+
+#ifdef ARRAY_SIMD_X86
+
+//------------------------------ simdLevel ------------------------------------
+// instruction set the kernels use on this processor, checked once
+inline int detectSimdLevel() {
+   __builtin_cpu_init();
+   if(ARRAY_SIMD_MAX_LEVEL >= 2 && __builtin_cpu_supports("avx2") &&
+                                   __builtin_cpu_supports("popcnt")) {
+      return 2;
+   }
+   if(ARRAY_SIMD_MAX_LEVEL >= 1 && __builtin_cpu_supports("sse4.2") &&
+                                   __builtin_cpu_supports("popcnt")) {
+      return 1;
+   }
+   return 0;
+}
+
+inline int simdLevel() {
+   static const int level = detectSimdLevel();
+   return level;
+}
+
+//------------------------------ lanes ----------------------------------------
+// Each lanes struct wraps the intrinsics for one item kind and one
+// instruction set: load, broadcast, a bit mask of the lanes equal to the
+// key, lane-wise min and max, and store. WIDTH is the number of items in
+// one vector.
+
+#define ARRAY_AVX2 __attribute__((target("avx2,popcnt"), always_inline))
+#define ARRAY_SSE42 __attribute__((target("sse4.2,popcnt"), always_inline))
+#define ARRAY_AVX2_KERNEL __attribute__((target("avx2,popcnt")))
+#define ARRAY_SSE42_KERNEL __attribute__((target("sse4.2,popcnt")))
+
+struct Avx2I32 {
+   typedef __m256i Vec;
+   typedef int32_t Lane;
+   static const int WIDTH = 8;
+   ARRAY_AVX2 static Vec load(const void* p) {
+      return _mm256_loadu_si256(static_cast<const __m256i*>(p));
+   }
+   ARRAY_AVX2 static Vec set(Lane key) { return _mm256_set1_epi32(key); }
+   ARRAY_AVX2 static unsigned equal(Vec a, Vec b) {
+      return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)));
+   }
+   ARRAY_AVX2 static Vec min(Vec a, Vec b) { return _mm256_min_epi32(a, b); }
+   ARRAY_AVX2 static Vec max(Vec a, Vec b) { return _mm256_max_epi32(a, b); }
+   ARRAY_AVX2 static void store(void* p, Vec a) {
+      _mm256_storeu_si256(static_cast<__m256i*>(p), a);
+   }
+};
+
+struct Avx2U32 : Avx2I32 {
+   ARRAY_AVX2 static Vec min(Vec a, Vec b) { return _mm256_min_epu32(a, b); }
+   ARRAY_AVX2 static Vec max(Vec a, Vec b) { return _mm256_max_epu32(a, b); }
+};
+
+struct Avx2I64 {
+   typedef __m256i Vec;
+   typedef int64_t Lane;
+   static const int WIDTH = 4;
+   ARRAY_AVX2 static Vec load(const void* p) {
+      return _mm256_loadu_si256(static_cast<const __m256i*>(p));
+   }
+   ARRAY_AVX2 static Vec set(Lane key) { return _mm256_set1_epi64x(key); }
+   ARRAY_AVX2 static unsigned equal(Vec a, Vec b) {
+      return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b)));
+   }
+   ARRAY_AVX2 static Vec min(Vec a, Vec b) {
+      return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b));
+   }
+   ARRAY_AVX2 static Vec max(Vec a, Vec b) {
+      return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b));
+   }
+   ARRAY_AVX2 static void store(void* p, Vec a) {
+      _mm256_storeu_si256(static_cast<__m256i*>(p), a);
+   }
+};
+
+// unsigned order is signed order with the top bit flipped
+struct Avx2U64 : Avx2I64 {
+   ARRAY_AVX2 static Vec greater(Vec a, Vec b) {
+      Vec flip = _mm256_set1_epi64x(INT64_MIN);
+      return _mm256_cmpgt_epi64(_mm256_xor_si256(a, flip),
+                                _mm256_xor_si256(b, flip));
+   }
+   ARRAY_AVX2 static Vec min(Vec a, Vec b) {
+      return _mm256_blendv_epi8(a, b, greater(a, b));
+   }
+   ARRAY_AVX2 static Vec max(Vec a, Vec b) {
+      return _mm256_blendv_epi8(b, a, greater(a, b));
+   }
+};
+
+struct Avx2F32 {
+   typedef __m256 Vec;
+   typedef float Lane;
+   static const int WIDTH = 8;
+   ARRAY_AVX2 static Vec load(const void* p) {
+      return _mm256_loadu_ps(static_cast<const float*>(p));
+   }
+   ARRAY_AVX2 static Vec set(Lane key) { return _mm256_set1_ps(key); }
+   ARRAY_AVX2 static unsigned equal(Vec a, Vec b) {
+      return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ));
+   }
+   ARRAY_AVX2 static Vec min(Vec a, Vec b) { return _mm256_min_ps(a, b); }
+   ARRAY_AVX2 static Vec max(Vec a, Vec b) { return _mm256_max_ps(a, b); }
+   ARRAY_AVX2 static void store(void* p, Vec a) {
+      _mm256_storeu_ps(static_cast<float*>(p), a);
+   }
+};
+
+struct Avx2F64 {
+   typedef __m256d Vec;
+   typedef double Lane;
+   static const int WIDTH = 4;
+   ARRAY_AVX2 static Vec load(const void* p) {
+      return _mm256_loadu_pd(static_cast<const double*>(p));
+   }
+   ARRAY_AVX2 static Vec set(Lane key) { return _mm256_set1_pd(key); }
+   ARRAY_AVX2 static unsigned equal(Vec a, Vec b) {
+      return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ));
+   }
+   ARRAY_AVX2 static Vec min(Vec a, Vec b) { return _mm256_min_pd(a, b); }
+   ARRAY_AVX2 static Vec max(Vec a, Vec b) { return _mm256_max_pd(a, b); }
+   ARRAY_AVX2 static void store(void* p, Vec a) {
+      _mm256_storeu_pd(static_cast<double*>(p), a);
+   }
+};
+
+struct SseI32 {
+   typedef __m128i Vec;
+   typedef int32_t Lane;
+   static const int WIDTH = 4;
+   ARRAY_SSE42 static Vec load(const void* p) {
+      return _mm_loadu_si128(static_cast<const __m128i*>(p));
+   }
+   ARRAY_SSE42 static Vec set(Lane key) { return _mm_set1_epi32(key); }
+   ARRAY_SSE42 static unsigned equal(Vec a, Vec b) {
+      return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b)));
+   }
+   ARRAY_SSE42 static Vec min(Vec a, Vec b) { return _mm_min_epi32(a, b); }
+   ARRAY_SSE42 static Vec max(Vec a, Vec b) { return _mm_max_epi32(a, b); }
+   ARRAY_SSE42 static void store(void* p, Vec a) {
+      _mm_storeu_si128(static_cast<__m128i*>(p), a);
+   }
+};
+
+struct SseU32 : SseI32 {
+   ARRAY_SSE42 static Vec min(Vec a, Vec b) { return _mm_min_epu32(a, b); }
+   ARRAY_SSE42 static Vec max(Vec a, Vec b) { return _mm_max_epu32(a, b); }
+};
+
+struct SseI64 {
+   typedef __m128i Vec;
+   typedef int64_t Lane;
+   static const int WIDTH = 2;
+   ARRAY_SSE42 static Vec load(const void* p) {
+      return _mm_loadu_si128(static_cast<const __m128i*>(p));
+   }
+   ARRAY_SSE42 static Vec set(Lane key) { return _mm_set1_epi64x(key); }
+   ARRAY_SSE42 static unsigned equal(Vec a, Vec b) {
+      return _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(a, b)));
+   }
+   ARRAY_SSE42 static Vec min(Vec a, Vec b) {
+      return _mm_blendv_epi8(a, b, _mm_cmpgt_epi64(a, b));
+   }
+   ARRAY_SSE42 static Vec max(Vec a, Vec b) {
+      return _mm_blendv_epi8(b, a, _mm_cmpgt_epi64(a, b));
+   }
+   ARRAY_SSE42 static void store(void* p, Vec a) {
+      _mm_storeu_si128(static_cast<__m128i*>(p), a);
+   }
+};
+
+struct SseU64 : SseI64 {
+   ARRAY_SSE42 static Vec greater(Vec a, Vec b) {
+      Vec flip = _mm_set1_epi64x(INT64_MIN);
+      return _mm_cmpgt_epi64(_mm_xor_si128(a, flip), _mm_xor_si128(b, flip));
+   }
+   ARRAY_SSE42 static Vec min(Vec a, Vec b) {
+      return _mm_blendv_epi8(a, b, greater(a, b));
+   }
+   ARRAY_SSE42 static Vec max(Vec a, Vec b) {
+      return _mm_blendv_epi8(b, a, greater(a, b));
+   }
+};
+
+struct SseF32 {
+   typedef __m128 Vec;
+   typedef float Lane;
+   static const int WIDTH = 4;
+   ARRAY_SSE42 static Vec load(const void* p) {
+      return _mm_loadu_ps(static_cast<const float*>(p));
+   }
+   ARRAY_SSE42 static Vec set(Lane key) { return _mm_set1_ps(key); }
+   ARRAY_SSE42 static unsigned equal(Vec a, Vec b) {
+      return _mm_movemask_ps(_mm_cmpeq_ps(a, b));
+   }
+   ARRAY_SSE42 static Vec min(Vec a, Vec b) { return _mm_min_ps(a, b); }
+   ARRAY_SSE42 static Vec max(Vec a, Vec b) { return _mm_max_ps(a, b); }
+   ARRAY_SSE42 static void store(void* p, Vec a) {
+      _mm_storeu_ps(static_cast<float*>(p), a);
+   }
+};
+
+struct SseF64 {
+   typedef __m128d Vec;
+   typedef double Lane;
+   static const int WIDTH = 2;
+   ARRAY_SSE42 static Vec load(const void* p) {
+      return _mm_loadu_pd(static_cast<const double*>(p));
+   }
+   ARRAY_SSE42 static Vec set(Lane key) { return _mm_set1_pd(key); }
+   ARRAY_SSE42 static unsigned equal(Vec a, Vec b) {
+      return _mm_movemask_pd(_mm_cmpeq_pd(a, b));
+   }
+   ARRAY_SSE42 static Vec min(Vec a, Vec b) { return _mm_min_pd(a, b); }
+   ARRAY_SSE42 static Vec max(Vec a, Vec b) { return _mm_max_pd(a, b); }
+   ARRAY_SSE42 static void store(void* p, Vec a) {
+      _mm_storeu_pd(static_cast<double*>(p), a);
+   }
+};
+
+// lanes struct for each item kind and instruction set
+template <int Kind> struct ScanLanes;
+template <> struct ScanLanes<SCAN_I32> { typedef Avx2I32 Avx2; typedef SseI32 Sse; };
+template <> struct ScanLanes<SCAN_U32> { typedef Avx2U32 Avx2; typedef SseU32 Sse; };
+template <> struct ScanLanes<SCAN_I64> { typedef Avx2I64 Avx2; typedef SseI64 Sse; };
+template <> struct ScanLanes<SCAN_U64> { typedef Avx2U64 Avx2; typedef SseU64 Sse; };
+template <> struct ScanLanes<SCAN_F32> { typedef Avx2F32 Avx2; typedef SseF32 Sse; };
+template <> struct ScanLanes<SCAN_F64> { typedef Avx2F64 Avx2; typedef SseF64 Sse; };
+
+//------------------------------ kernels --------------------------------------
+// findFirst, count and min or max with one lanes struct: whole vectors
+// first, then the items left over with the plain loop. GCC only inlines
+// the lanes functions into a function built for the same instruction set,
+// so there is one copy of the kernels for AVX2 and one for SSE4.2.
+
+template <typename Lanes, typename ItemType>
+ARRAY_AVX2_KERNEL
+int findFirstAvx2(const ItemType* items, int n, ItemType key) {
+   typename Lanes::Vec wanted = Lanes::set(key);
+   int i = 0;
+   for(; i + Lanes::WIDTH <= n; i += Lanes::WIDTH) {
+      unsigned mask = Lanes::equal(Lanes::load(items + i), wanted);
+      if(mask != 0) {
+         return i + __builtin_ctz(mask);
+      }
+   }
+   int rest = ArrayScan<ItemType, SCAN_NONE>::findFirst(items + i, n - i, key);
+   return rest < 0 ? -1 : i + rest;
+}
+
+template <typename Lanes, typename ItemType>
+ARRAY_AVX2_KERNEL
+int countAvx2(const ItemType* items, int n, ItemType key) {
+   typename Lanes::Vec wanted = Lanes::set(key);
+   int counter = 0;
+   int i = 0;
+   for(; i + Lanes::WIDTH <= n; i += Lanes::WIDTH) {
+      unsigned mask = Lanes::equal(Lanes::load(items + i), wanted);
+      counter += __builtin_popcount(mask);
+   }
+   return counter + ArrayScan<ItemType, SCAN_NONE>::count(items + i, n - i,
+                                                          key);
+}
+
+template <typename Lanes, bool Max, typename ItemType>
+ARRAY_AVX2_KERNEL
+ItemType extremeAvx2(const ItemType* items, int n) {
+   typedef ArrayScan<ItemType, SCAN_NONE> Plain;
+   if(n < Lanes::WIDTH) {
+      return Max ? Plain::max(items, n) : Plain::min(items, n);
+   }
+   typename Lanes::Vec best = Lanes::load(items);
+   int i = Lanes::WIDTH;
+   for(; i + Lanes::WIDTH <= n; i += Lanes::WIDTH) {
+      typename Lanes::Vec next = Lanes::load(items + i);
+      best = Max ? Lanes::max(best, next) : Lanes::min(best, next);
+   }
+
+   // best of the lanes, then of the items left over
+   ItemType lanes[Lanes::WIDTH];
+   Lanes::store(lanes, best);
+   ItemType result = Max ? Plain::max(lanes, Lanes::WIDTH)
+                         : Plain::min(lanes, Lanes::WIDTH);
+   for(; i < n; i++) {
+      if(Max ? result < items[i] : items[i] < result) {
+         result = items[i];
+      }
+   }
+   return result;
+}
+
+template <typename Lanes, typename ItemType>
+ARRAY_SSE42_KERNEL
+int findFirstSse(const ItemType* items, int n, ItemType key) {
+   typename Lanes::Vec wanted = Lanes::set(key);
+   int i = 0;
+   for(; i + Lanes::WIDTH <= n; i += Lanes::WIDTH) {
+      unsigned mask = Lanes::equal(Lanes::load(items + i), wanted);
+      if(mask != 0) {
+         return i + __builtin_ctz(mask);
+      }
+   }
+   int rest = ArrayScan<ItemType, SCAN_NONE>::findFirst(items + i, n - i, key);
+   return rest < 0 ? -1 : i + rest;
+}
+
+template <typename Lanes, typename ItemType>
+ARRAY_SSE42_KERNEL
+int countSse(const ItemType* items, int n, ItemType key) {
+   typename Lanes::Vec wanted = Lanes::set(key);
+   int counter = 0;
+   int i = 0;
+   for(; i + Lanes::WIDTH <= n; i += Lanes::WIDTH) {
+      unsigned mask = Lanes::equal(Lanes::load(items + i), wanted);
+      counter += __builtin_popcount(mask);
+   }
+   return counter + ArrayScan<ItemType, SCAN_NONE>::count(items + i, n - i,
+                                                          key);
+}
+
+template <typename Lanes, bool Max, typename ItemType>
+ARRAY_SSE42_KERNEL
+ItemType extremeSse(const ItemType* items, int n) {
+   typedef ArrayScan<ItemType, SCAN_NONE> Plain;
+   if(n < Lanes::WIDTH) {
+      return Max ? Plain::max(items, n) : Plain::min(items, n);
+   }
+   typename Lanes::Vec best = Lanes::load(items);
+   int i = Lanes::WIDTH;
+   for(; i + Lanes::WIDTH <= n; i += Lanes::WIDTH) {
+      typename Lanes::Vec next = Lanes::load(items + i);
+      best = Max ? Lanes::max(best, next) : Lanes::min(best, next);
+   }
+
+   // best of the lanes, then of the items left over
+   ItemType lanes[Lanes::WIDTH];
+   Lanes::store(lanes, best);
+   ItemType result = Max ? Plain::max(lanes, Lanes::WIDTH)
+                         : Plain::min(lanes, Lanes::WIDTH);
+   for(; i < n; i++) {
+      if(Max ? result < items[i] : items[i] < result) {
+         result = items[i];
+      }
+   }
+   return result;
+}
+
+#undef ARRAY_AVX2_KERNEL
+#undef ARRAY_SSE42_KERNEL
+#undef ARRAY_AVX2
+#undef ARRAY_SSE42
+
+//------------------------------ ArrayScan ------------------------------------
+// item types with SIMD kernels, each call goes to the kernel for the
+// processor's instruction set; a lower level may be passed to run the
+// other kernels, as the driver does to check them against the plain loops
+template <typename ItemType>
+struct ArraySimdScan {
+   typedef ScanLanes<ScanKindOf<ItemType>::value> Lanes;
+
+   static int findFirst(const ItemType* items, int n, const ItemType& key,
+                        int level = simdLevel()) {
+      switch(level) {
+      case 2:  return findFirstAvx2<typename Lanes::Avx2>(items, n, key);
+      case 1:  return findFirstSse<typename Lanes::Sse>(items, n, key);
+      default: return ArrayScan<ItemType, SCAN_NONE>::findFirst(items, n, key);
+      }
+   }
+
+   static int count(const ItemType* items, int n, const ItemType& key,
+                    int level = simdLevel()) {
+      switch(level) {
+      case 2:  return countAvx2<typename Lanes::Avx2>(items, n, key);
+      case 1:  return countSse<typename Lanes::Sse>(items, n, key);
+      default: return ArrayScan<ItemType, SCAN_NONE>::count(items, n, key);
+      }
+   }
+
+   static ItemType min(const ItemType* items, int n, int level = simdLevel()) {
+      switch(level) {
+      case 2:  return extremeAvx2<typename Lanes::Avx2, false>(items, n);
+      case 1:  return extremeSse<typename Lanes::Sse, false>(items, n);
+      default: return ArrayScan<ItemType, SCAN_NONE>::min(items, n);
+      }
+   }
+
+   static ItemType max(const ItemType* items, int n, int level = simdLevel()) {
+      switch(level) {
+      case 2:  return extremeAvx2<typename Lanes::Avx2, true>(items, n);
+      case 1:  return extremeSse<typename Lanes::Sse, true>(items, n);
+      default: return ArrayScan<ItemType, SCAN_NONE>::max(items, n);
+      }
+   }
+};
+
+template <typename ItemType>
+struct ArrayScan<ItemType, SCAN_I32> : ArraySimdScan<ItemType> {};
+template <typename ItemType>
+struct ArrayScan<ItemType, SCAN_U32> : ArraySimdScan<ItemType> {};
+template <typename ItemType>
+struct ArrayScan<ItemType, SCAN_I64> : ArraySimdScan<ItemType> {};
+template <typename ItemType>
+struct ArrayScan<ItemType, SCAN_U64> : ArraySimdScan<ItemType> {};
+template <typename ItemType>
+struct ArrayScan<ItemType, SCAN_F32> : ArraySimdScan<ItemType> {};
+template <typename ItemType>
+struct ArrayScan<ItemType, SCAN_F64> : ArraySimdScan<ItemType> {};
+
+#endif
+
+#endif
@@ -1,6 +1,9 @@
 // Driver to test our class Array template
 #include "array.h"
+#include "mappedarray.h"
 #include "nodedata.h"
+#include <cstdint>
+#include <cstdio>
 #include <string>
 #include <iostream>
 using namespace std;
@@ -8,6 +11,52 @@ using namespace std;
 // To compile using g++, enter
 //   g++ arraytemplatedriver.cpp nodedata.cpp
 
+#ifdef ARRAY_SIMD_X86
+// next pseudo-random item: mostly one of a few small values, so keys repeat,
+// and now and then one from anywhere in the type's range (large unsigned
+// values have the sign bit set, where signed lane compares go wrong)
+template <typename ItemType>
+ItemType scanValue(unsigned long long& seed) {
+   seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+   unsigned long long bits = seed >> 11;
+   if(bits % 4 != 0) {
+      return ItemType(int(bits % 50) - 25);
+   }
+   return ItemType(bits * 0x9e3779b97f4a7c15ULL);
+}
+
+// runs the kernels of every instruction set this processor has on arrays
+// of many lengths, true if each agrees with the plain loops
+template <typename ItemType>
+bool scanMatchesPlain() {
+   typedef ArrayScan<ItemType> Scan;
+   typedef ArrayScan<ItemType, SCAN_NONE> Plain;
+   unsigned long long seed = 2024;
+   bool ok = true;
+   // every length around the vector widths, then a few longer ones
+   for(int n = 1; n <= 1003; n += (n < 70 ? 1 : 233)) {
+      Array<ItemType> items(n);
+      for(int i = 0; i < n; i++) {
+         items[i] = scanValue<ItemType>(seed);
+      }
+      const ItemType* p = &items[0];
+      ItemType keys[] = { items[0], items[n / 2], items[n - 1],
+                          scanValue<ItemType>(seed) };
+      for(int level = 0; level <= simdLevel(); level++) {
+         for(const ItemType& key : keys) {
+            ok = ok && Scan::findFirst(p, n, key, level) ==
+                       Plain::findFirst(p, n, key) &&
+                       Scan::count(p, n, key, level) ==
+                       Plain::count(p, n, key);
+         }
+         ok = ok && Scan::min(p, n, level) == Plain::min(p, n) &&
+                    Scan::max(p, n, level) == Plain::max(p, n);
+      }
+   }
+   return ok;
+}
+#endif
+
 int main() {
    cout << "************* create int Array objects, test, print **************"
         << endl;
@@ -57,5 +106,122 @@ int main() {
    cout << "Evaluating  stuff == morestuff:   "
         << (stuff == morestuff ? "equal" : "not equal") << endl << endl;
 
+   cout << "************* search int and double Array objects ***************"
+        << endl;
+   // long enough for whole vectors of items plus a few left over
+   Array<int> counts(1003);
+   Array<double> prices(1003);
+   for(int i = 0; i < counts.size(); i++) {
+      counts[i] = i % 97;
+      prices[i] = (i % 89) * 1.5;
+   }
+   counts[700] = -5;
+   prices[900] = 1000.25;
+   cout << "first 50 in counts is at:  " << counts.findFirst(50) << endl;
+   cout << "frequency of 0 in counts:  " << counts.getFrequencyOf(0) << endl;
+   cout << "counts contains 100:  "
+        << (counts.contains(100) ? "yes" : "no") << endl;
+   cout << "counts min and max:  " << counts.getMin() << " "
+        << counts.getMax() << endl;
+   cout << "first 3 in prices is at:  " << prices.findFirst(3.0) << endl;
+   cout << "frequency of 0 in prices:  " << prices.getFrequencyOf(0.0)
+        << endl;
+   cout << "prices min and max:  " << prices.getMin() << " "
+        << prices.getMax() << endl;
+#ifdef ARRAY_SIMD_X86
+   cout << "SIMD scans match the plain loops for uint32_t, int64_t, "
+        << "uint64_t, float:  "
+        << (scanMatchesPlain<uint32_t>() ? "yes " : "no ")
+        << (scanMatchesPlain<int64_t>() ? "yes " : "no ")
+        << (scanMatchesPlain<uint64_t>() ? "yes " : "no ")
+        << (scanMatchesPlain<float>() ? "yes" : "no") << endl;
+#endif
+   cout << endl;
+
+   cout << "************ grow, shrink and move Array objects *****************"
+        << endl;
+   Array<string> words;
+   words.pushBack(s1);
+   words.pushBack("there");
+   words.emplaceBack(3, '!');
+   cout << "words contains:  " << words;
+   cout << "words size and capacity:  " << words.size() << " "
+        << words.capacity() << endl;
+   // once shrunk the array is full, the copy of words[0] is made before
+   // it grows
+   words.shrinkToFit();
+   words.emplaceBack(words[0]);
+   cout << "after shrinkToFit and emplaceBack(words[0]):  " << words;
+   cout << "words size and capacity:  " << words.size() << " "
+        << words.capacity() << endl;
+   words.reserve(200);
+   cout << "after reserve(200), ";
+   cout << "words size and capacity:  " << words.size() << " "
+        << words.capacity() << endl;
+   words.resize(6);
+   words[5] = s2;
+   words.resize(5);
+   words.shrinkToFit();
+   cout << "after resize(6), resize(5) and shrinkToFit:  " << words;
+   cout << "words size and capacity:  " << words.size() << " "
+        << words.capacity() << endl;
+   Array<string> moved(std::move(words));
+   cout << "moved contains:  " << moved;
+   cout << "words size after the move:  " << words.size() << endl;
+   words = std::move(moved);
+   cout << "words after moving back:  " << words;
+   Array<NodeData> nodes;
+   for(int i = 0; i < 3; i++) {
+      nodes.emplaceBack(i, 'a' + i);
+   }
+   cout << "nodes contains:  " << nodes << endl;
+
+   cout << "*************** Array objects with other allocators **************"
+        << endl;
+   Array<int, AlignedAllocator<128> > wide(10);
+   cout << "wide[0] is aligned to 128 bytes:  "
+        << (reinterpret_cast<uintptr_t>(&wide[0]) % 128 == 0 ? "yes" : "no")
+        << endl;
+   // 8 MiB of items, mapped in huge pages
+   Array<int, HugePageAllocator<> > big(1 << 21);
+   for(int i = 0; i < big.size(); i++) {
+      big[i] = i;
+   }
+   cout << "big size, min and max:  " << big.size() << " " << big.getMin()
+        << " " << big.getMax() << endl;
+   big.resize(10);
+   big.shrinkToFit();
+   cout << "big after resize(10) and shrinkToFit:  " << big << endl;
+
+   cout << "***************** map Array objects from a file *****************"
+        << endl;
+   MappedArray<int>::write("counts.arr", counts);
+   MappedArray<int> readOnly("counts.arr");
+   cout << "counts.arr opened:  " << (readOnly.isOpen() ? "yes" : "no")
+        << ", size:  " << readOnly.size() << endl;
+   cout << "counts.arr contains -5:  "
+        << (readOnly.contains(-5) ? "yes" : "no") << endl;
+   cout << "toVector matches counts:  "
+        << (readOnly.toVector() == counts.toVector() ? "yes" : "no") << endl;
+   // a READ_ONLY mapping is private, changes stay out of the file
+   readOnly[0] = 99;
+   {
+      MappedArray<int> readWrite("counts.arr", MappedArray<int>::READ_WRITE);
+      readWrite[1] = 42;
+   }
+   readOnly = MappedArray<int>("counts.arr");
+   cout << "counts.arr[0] and [1] after changes:  " << readOnly[0] << " "
+        << readOnly[1] << endl;
+   MappedArray<float> wrongType("counts.arr");
+   cout << "counts.arr opened as float:  "
+        << (wrongType.isOpen() ? "yes" : "no") << endl;
+   MappedArray<double>::create("zeros.arr", 5);
+   MappedArray<double> zeros("zeros.arr");
+   cout << "zeros.arr contains:  " << zeros << endl;
+   readOnly.close();
+   zeros.close();
+   remove("counts.arr");
+   remove("zeros.arr");
+
    return 0;
 }
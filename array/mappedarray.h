@@ -0,0 +1,368 @@
+#ifndef MAPPEDARRAY_H
+#define MAPPEDARRAY_H
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <climits>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "array.h"
+using namespace std;
+
+//---------------------------------------------------------------------------
+// MappedArray class:  an array of trivially copyable items kept in a binary
+//   file and mapped into memory, so opening a large data set costs an mmap
+//   instead of parsing text with Array's >>
+//   -- same operator[], size, contains and toVector as Array; contains
+//      scans with ArrayScan like Array does
+//   -- opened READ_WRITE, item changes go to the file, or READ_ONLY, the
+//      file is never changed and changed items are private copies of pages
+//   -- write saves an Array, create makes a file of zeroed items
+//   -- allows output of the whole array, 10 per line like Array
+//
+// File layout:
+//   -- a 64 byte header: magic "ARRY", format version, item size, item
+//      type tag (MappedTypeTag), item count and a byte order mark,
+//      followed by the items, so they start on a cache line
+//   -- items are stored in the byte order of the machine that wrote them;
+//      a file from a machine of the other byte order does not open
+//
+// Assumptions:
+//   -- a POSIX system with mmap
+//   -- opening fails, leaving an empty MappedArray with isOpen() false,
+//      when the file is missing, its header does not match ItemType or
+//      the file is shorter than the header says
+//   -- the mapping belongs to the object: MappedArray can be moved but not
+//      copied, a moved-from MappedArray is closed
+//   -- subscripts are range checked, program terminates when out of bounds
+//---------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------
+// MappedTypeTag:  the item type tag saved in a MappedArray file header.
+//   The values are part of the file format and never change; with the item
+//   size they tell int from unsigned int from float. Types that are not
+//   numbers get MAPPED_OTHER, a specialization can give a type its own tag
+//   (MAPPED_USER and up) so files of other types with the same size do not
+//   open as it.
+//---------------------------------------------------------------------------
+
+enum MappedTag : uint32_t {
+   MAPPED_OTHER = 0,                // class, enum or pointer type
+   MAPPED_SIGNED = 1,               // signed integer
+   MAPPED_UNSIGNED = 2,             // unsigned integer
+   MAPPED_FLOAT = 3,                // floating point
+   MAPPED_BOOL = 4,
+   MAPPED_CHAR = 5,                 // plain char, signed or not by platform
+   MAPPED_USER = 256                // first tag for specializations
+};
+
+template <typename ItemType>
+struct MappedTypeTag {
+   static const uint32_t value =
+      is_same<ItemType, bool>::value ? MAPPED_BOOL :
+      is_same<ItemType, char>::value ? MAPPED_CHAR :
+      is_floating_point<ItemType>::value ? MAPPED_FLOAT :
+      is_integral<ItemType>::value ?
+         (is_signed<ItemType>::value ? MAPPED_SIGNED : MAPPED_UNSIGNED) :
+      MAPPED_OTHER;
+};
+
+template <typename ItemType>
+class MappedArray {
+   static_assert(is_trivially_copyable<ItemType>::value,
+                 "MappedArray holds trivially copyable items only");
+
+friend ostream& operator<<(ostream &output, const MappedArray &a) {
+   int i;
+   for (i = 0; i < a.arraySize; i++) {
+      output << a.items[i] << ' ';
+      if ((i + 1) % 10 == 0)           // display 10 per line
+         output << endl;
+   }
+
+   if (i % 10 != 0) output << endl;
+   return output;
+}
+public:
+   enum Mode { READ_ONLY, READ_WRITE };
+
+   MappedArray();                                   // closed, empty array
+   MappedArray(const char* path, Mode mode = READ_ONLY);
+   MappedArray(MappedArray&&) noexcept;             // move constructor
+   MappedArray& operator=(MappedArray&&) noexcept;  // move assignment
+   ~MappedArray();                                  // unmaps the file
+
+   MappedArray(const MappedArray&) = delete;
+   MappedArray& operator=(const MappedArray&) = delete;
+
+   // writes the items of an Array to a new file at path
+   template <typename Allocator>
+   static bool write(const char* path, const Array<ItemType, Allocator>& a);
+
+   // makes a file at path holding count zeroed items
+   static bool create(const char* path, int count);
+
+   // true when a file is mapped
+   bool isOpen() const;
+
+   // unmaps the file, the array becomes empty
+   void close();
+
+   // subscript operators
+   ItemType& operator[](int);
+   const ItemType& operator[](int) const;
+
+   // return size of array
+   int size() const;
+
+   // returns true if array contains anEntry
+   bool contains(const ItemType& anEntry) const;
+
+   // copies the items to a vector
+   vector<ItemType> toVector() const;
+
+private:
+   static const char MAGIC[4];
+   static const uint32_t VERSION = 2;
+   // byte order mark, reads back as 0x04030201 on the other byte order
+   static const uint32_t ORDER_MARK = 0x01020304;
+
+   struct Header {
+      char magic[4];
+      uint32_t version;
+      uint32_t itemSize;
+      uint32_t itemTag;             // MappedTypeTag of the items
+      uint64_t count;
+      uint32_t byteOrder;           // ORDER_MARK as the writer stored it
+      char unused[36];              // pads the header to a cache line
+   };
+   static_assert(sizeof(Header) == 64, "Header must be 64 bytes");
+
+   void* mapping;                   // start of the mapped file, or nullptr
+   size_t mappingLength;            // bytes mapped
+   ItemType* items;                 // first item, just past the header
+   int arraySize;                   // number of items
+
+   static Header makeHeader(int count);
+   static bool writeFile(const char* path, const ItemType* data, int count);
+   bool open(const char* path, Mode mode);
+};
+
+template <typename ItemType>
+const char MappedArray<ItemType>::MAGIC[4] = { 'A', 'R', 'R', 'Y' };
+
+//------------------------------ Constructor ----------------------------------
+// closed array, nothing mapped
+template <typename ItemType>
+MappedArray<ItemType>::MappedArray()
+   : mapping(nullptr), mappingLength(0), items(nullptr), arraySize(0) {
+}
+
+//------------------------------ Constructor ----------------------------------
+// maps the file at path, check isOpen() to see whether it worked
+template <typename ItemType>
+MappedArray<ItemType>::MappedArray(const char* path, Mode mode)
+   : mapping(nullptr), mappingLength(0), items(nullptr), arraySize(0) {
+   open(path, mode);
+}
+
+//--------------------------- Move Constructor --------------------------------
+// takes the mapping of right, which is left closed
+template <typename ItemType>
+MappedArray<ItemType>::MappedArray(MappedArray&& right) noexcept
+   : mapping(right.mapping), mappingLength(right.mappingLength),
+     items(right.items), arraySize(right.arraySize) {
+   right.mapping = nullptr;
+   right.mappingLength = 0;
+   right.items = nullptr;
+   right.arraySize = 0;
+}
+
+//---------------------------- operator= --------------------------------------
+// unmaps the current file and takes right's mapping
+template <typename ItemType>
+MappedArray<ItemType>&
+MappedArray<ItemType>::operator=(MappedArray&& right) noexcept {
+   if(this != &right) {
+      close();
+      mapping = right.mapping;
+      mappingLength = right.mappingLength;
+      items = right.items;
+      arraySize = right.arraySize;
+      right.mapping = nullptr;
+      right.mappingLength = 0;
+      right.items = nullptr;
+      right.arraySize = 0;
+   }
+   return *this;
+}
+
+//------------------------------- Destructor ----------------------------------
+template <typename ItemType>
+MappedArray<ItemType>::~MappedArray() {
+   close();
+}
+
+//------------------------------ makeHeader -----------------------------------
+// header describing count items of ItemType
+template <typename ItemType>
+typename MappedArray<ItemType>::Header
+MappedArray<ItemType>::makeHeader(int count) {
+   Header header;
+   memset(&header, 0, sizeof(Header));
+   memcpy(header.magic, MAGIC, sizeof(MAGIC));
+   header.version = VERSION;
+   header.itemSize = sizeof(ItemType);
+   header.itemTag = MappedTypeTag<ItemType>::value;
+   header.count = count;
+   header.byteOrder = ORDER_MARK;
+   return header;
+}
+
+//------------------------------ writeFile ------------------------------------
+// writes the header and count items from data, or zeroes when data is
+// nullptr, to a new file at path; returns false if any step fails
+template <typename ItemType>
+bool MappedArray<ItemType>::writeFile(const char* path, const ItemType* data,
+                                      int count) {
+   assert(count >= 0);
+   int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+   if(fd < 0) {
+      return false;
+   }
+   Header header = makeHeader(count);
+   off_t length = sizeof(Header) + off_t(count) * sizeof(ItemType);
+   bool ok = ::write(fd, &header, sizeof(Header)) == ssize_t(sizeof(Header));
+   if(ok && data != nullptr) {
+      const char* next = reinterpret_cast<const char*>(data);
+      size_t left = size_t(count) * sizeof(ItemType);
+      while(ok && left > 0) {
+         ssize_t written = ::write(fd, next, left);
+         ok = written > 0;
+         if(ok) {
+            next += written;
+            left -= written;
+         }
+      }
+   }
+   // for create, extends the file with zeroes without writing them
+   ok = ok && ftruncate(fd, length) == 0;
+   return ::close(fd) == 0 && ok;
+}
+
+//-------------------------------- write --------------------------------------
+template <typename ItemType>
+template <typename Allocator>
+bool MappedArray<ItemType>::write(const char* path,
+                                  const Array<ItemType, Allocator>& a) {
+   return writeFile(path, a.size() > 0 ? &a[0] : nullptr, a.size());
+}
+
+//-------------------------------- create -------------------------------------
+template <typename ItemType>
+bool MappedArray<ItemType>::create(const char* path, int count) {
+   return writeFile(path, nullptr, count);
+}
+
+//--------------------------------- open --------------------------------------
+// maps the whole file after checking that its header matches ItemType:
+// shared for READ_WRITE so changes reach the file, private copy-on-write
+// for READ_ONLY
+template <typename ItemType>
+bool MappedArray<ItemType>::open(const char* path, Mode mode) {
+   int fd = ::open(path, mode == READ_WRITE ? O_RDWR : O_RDONLY);
+   if(fd < 0) {
+      return false;
+   }
+   struct stat info;
+   Header header;
+   bool ok = fstat(fd, &info) == 0 && size_t(info.st_size) >= sizeof(Header) &&
+             pread(fd, &header, sizeof(Header), 0) == ssize_t(sizeof(Header));
+   ok = ok && memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0 &&
+        header.version == VERSION &&
+        header.itemSize == sizeof(ItemType) &&
+        header.byteOrder == ORDER_MARK &&
+        header.itemTag == MappedTypeTag<ItemType>::value &&
+        header.count <= uint64_t(INT_MAX) &&
+        header.count <= (uint64_t(info.st_size) - sizeof(Header)) /
+                        sizeof(ItemType);
+   void* start = MAP_FAILED;
+   size_t length = 0;
+   if(ok) {
+      length = sizeof(Header) + size_t(header.count) * sizeof(ItemType);
+      int sharing = mode == READ_WRITE ? MAP_SHARED : MAP_PRIVATE;
+      start = mmap(nullptr, length, PROT_READ | PROT_WRITE, sharing, fd, 0);
+   }
+   ::close(fd);                     // the mapping keeps the file open
+   if(start == MAP_FAILED) {
+      return false;
+   }
+   mapping = start;
+   mappingLength = length;
+   items = reinterpret_cast<ItemType*>(static_cast<char*>(start) +
+                                       sizeof(Header));
+   arraySize = int(header.count);
+   return true;
+}
+
+//--------------------------------- close -------------------------------------
+template <typename ItemType>
+void MappedArray<ItemType>::close() {
+   if(mapping != nullptr) {
+      munmap(mapping, mappingLength);
+   }
+   mapping = nullptr;
+   mappingLength = 0;
+   items = nullptr;
+   arraySize = 0;
+}
+
+//-------------------------------- isOpen -------------------------------------
+template <typename ItemType>
+bool MappedArray<ItemType>::isOpen() const {
+   return mapping != nullptr;
+}
+
+//-------------------------------  []  ----------------------------------------
+// [] mutator, terminates if subscript out of range
+template <typename ItemType>
+ItemType& MappedArray<ItemType>::operator[](int subscript) {
+   assert(0 <= subscript && subscript < arraySize);
+   return items[subscript];
+}
+
+// ------------------------------- [] -----------------------------------------
+// [] accessor, terminates if subscript out of range
+template <typename ItemType>
+const ItemType& MappedArray<ItemType>::operator[](int subscript) const {
+   assert(0 <= subscript && subscript < arraySize);
+   return items[subscript];
+}
+
+// ------------------------------ size ----------------------------------------
+template <typename ItemType>
+int MappedArray<ItemType>::size() const {
+   return arraySize;
+}
+
+// ---------------------------- contains --------------------------------------
+// returns true if array contains anEntry; return false otherwise
+template <typename ItemType>
+bool MappedArray<ItemType>::contains(const ItemType& anEntry) const {
+   return ArrayScan<ItemType>::findFirst(items, arraySize, anEntry) >= 0;
+}
+
+// ---------------------------- toVector --------------------------------------
+// copies the items to a vector
+template <typename ItemType>
+vector<ItemType> MappedArray<ItemType>::toVector() const {
+   return vector<ItemType>(items, items + arraySize);
+}
+
+#endif
@@ -22,36 +22,87 @@
 //   -- operator<< dislplays the nodes of the BinTree in an inorder fashion
 //   -- all functions use recursive helpers except the default constructor and
 //      isEmpty
-//   -- getHeight is implemented in a way works for both Binary Search Trees
-//      and general Binary Trees where data could be stored anywhere.
-//    - getHeight is implemented using this height definition:
+//   -- height and nodeHeight use this height definition:
 //          The height of a node at a leaf is 1, height of a node at the next
 //          level is 2, and so on. The height of a value not found is zero.
 //   -- An empty tree has 0 nodes
+//   -- every node caches the number of nodes in its subtree and its height;
+//      insert, erase and removeLeaves keep them current, so getCount and
+//      height are O(1), and select, rank and nodeHeight are a single BST
+//      descent (O(height))
+//   -- const_iterator is bidirectional and walks the tree in order; it keeps
+//      the path from the root, so ++ and -- are amortized O(1) and no parent
+//      pointers are needed. Inserting or erasing invalidates iterators.
+//   -- forEachInRange is inclusive on both ends and only descends into
+//      subtrees that can hold keys inside the range
+//   -- arrayToBSTree and buildFromSorted link nodes directly from a sorted
+//      range in O(n), middle element as root, without searching the tree;
+//      arrayToBSTree does so only into an empty tree from strictly
+//      increasing data, otherwise it inserts middle first as it always has
+//   -- bstreeToArray and extract hand the ItemType pointers over to the
+//      caller in sorted order instead of copying the data
+//   -- nodes come from the Allocator policy (see nodepool.h); the default
+//      NodePool hands them out of large blocks and makeEmpty frees the
+//      blocks all at once instead of deleting every node
+//   -- unionWith, intersectWith and difference are join based: the other
+//      tree is split around each root and the pieces are joined back with
+//      AVL rotations using the cached heights, O(m log(n/m + 1)) for sizes
+//      m <= n when the inputs are balanced; results come out balanced.
+//      Above PARALLEL_CUTOFF items the two recursive halves run as separate
+//      tasks, down to a depth set by the number of hardware threads.
+//      Removed nodes are collected and freed afterwards, since the node
+//      allocator is only used from the calling thread
+//   -- copying and emptying a tree of PARALLEL_CUTOFF or more items fork the
+//      same way: a copy takes all of its nodes from the allocator first and
+//      the tasks fill in disjoint inorder ranges of them, emptying deletes
+//      the items in parallel before the node blocks are released.
+//      parallelReduce folds the items with the same forking
+//   -- intrusivebintree.h has a variant whose links live inside the items
+//   -- operator== compares contents, not shapes: trees holding the same items
+//      are equal however they were built. Trees whose counts differ are
+//      unequal in O(1), otherwise the two trees are walked in order and the
+//      first difference stops it
+//   -- digest is the sum of a mixed std::hash of each item, so it does not
+//      depend on shape; it is computed in O(n) when asked for, and only
+//      then does ItemType need a std::hash specialization
 
 // ---------------------------------------------------------------------------
 
 #ifndef BINTREE_H
 #define BINTREE_H
 #include <iostream>
+#include <cassert>
 #include <string>
+#include <algorithm>
+#include <vector>
+#include <iterator>
+#include <utility>
+#include <functional>
+#include <future>
+#include <thread>
 #include "nodedata.h"
+#include "nodepool.h"
 using namespace std;
 
-template <typename ItemType>
+template <typename ItemType,
+          template <typename> class Allocator = NodePool>
 class BinTree {
 //--------------------------- operator<< ------------------------------------
 // Description:
 // displays the tree using inorder traversal
 // Preconditions:   ItemType class is responsible for displaying its own data
 // Postconditions:  each node in *this BSTree is output onto the screen
-friend ostream& operator<<(ostream& output, const BinTree<ItemType>& treeDisplay) {
-   typename BinTree<ItemType>::Node* current = treeDisplay.root;
+friend ostream& operator<<(ostream& output,
+                           const BinTree<ItemType, Allocator>& treeDisplay) {
+   typename BinTree<ItemType, Allocator>::Node* current = treeDisplay.root;
    treeDisplay.inorderHelper(output, current);
    output << endl;
    return output;
 }
 
+private:
+   struct Node;                        // tree node, defined below
+
 public:
    BinTree(string = "");        // constructor
    BinTree(const BinTree &);    // copy constructor
@@ -86,6 +137,15 @@ public:
    // get the total number of nodes in a BSTree
    int getCount() const;
    
+   // hash of the contents, equal trees have equal digests
+   unsigned long long digest() const;
+   
+   // retrieve the item with exactly k smaller items (k is 0 based)
+   bool select(int, ItemType* &) const;
+   
+   // get the number of items less than the given item
+   int rank(const ItemType &) const;
+   
    // remove all leaves in a BSTree
    void removeLeaves();
    
@@ -95,49 +155,140 @@ public:
    // builds a balanced BinTree from a sorted array of NodeData*
    void arrayToBSTree(ItemType* []);
    
+   // builds a balanced BinTree from a sorted range of ItemType*
+   template <typename ForwardIterator>
+   void buildFromSorted(ForwardIterator, ForwardIterator);
+   void buildFromSorted(const vector<ItemType*> &);
+   
+   // moves every ItemType* out in sorted order, the tree is left empty
+   vector<ItemType*> extract();
+   
+   // the data of the tree in sorted order, the tree keeps ownership
+   vector<const ItemType*> toSortedVector() const;
+   
    // displays the tree sideways
    void displaySideways() const;
    
+   // bidirectional iterator over the data in sorted (inorder) order
+   class const_iterator {
+   public:
+      typedef bidirectional_iterator_tag iterator_category;
+      typedef ItemType value_type;
+      typedef ptrdiff_t difference_type;
+      typedef const ItemType* pointer;
+      typedef const ItemType& reference;
+
+      const_iterator() : tree(nullptr) {}
+      const ItemType& operator*() const { return *path.back()->data; }
+      const ItemType* operator->() const { return path.back()->data; }
+      const_iterator& operator++();
+      const_iterator& operator--();
+      const_iterator operator++(int) {
+         const_iterator old = *this;
+         ++*this;
+         return old;
+      }
+      const_iterator operator--(int) {
+         const_iterator old = *this;
+         --*this;
+         return old;
+      }
+      bool operator==(const const_iterator& rhs) const {
+         return path.empty() ? rhs.path.empty()
+                  : (!rhs.path.empty() && path.back() == rhs.path.back());
+      }
+      bool operator!=(const const_iterator& rhs) const {
+         return !(*this == rhs);
+      }
+   private:
+      friend class BinTree;
+      const BinTree* tree;             // tree being walked, used by --end()
+      vector<Node*> path;              // root to current node, empty at end
+   };
+   typedef const_iterator iterator;
+   
+   const_iterator begin() const;
+   const_iterator end() const;
+   
+   // first item not less than the target
+   const_iterator lowerBound(const ItemType &) const;
+   
+   // first item greater than the target
+   const_iterator upperBound(const ItemType &) const;
+   
+   // range of items equal to the target (at most one, there are no dups)
+   pair<const_iterator, const_iterator> equalRange(const ItemType &) const;
+   
+   // call fn on every item with lo <= item <= hi, in sorted order
+   template <typename Function>
+   void forEachInRange(const ItemType &, const ItemType &, Function) const;
+   
+   // move every item of the other tree into *this, other is left empty
+   void unionWith(BinTree &);
+   
+   // keep only the items that are also in the other tree
+   void intersectWith(const BinTree &);
+   
+   // remove the items that are in the other tree
+   void difference(const BinTree &);
+   
+   // combine map(item) over all items in order, combine must be associative
+   template <typename Result, typename Map, typename Combine>
+   Result parallelReduce(Result, Map, Combine) const;
+   
 private:
    struct Node {
       ItemType* data;                  // pointer to data object
       Node* left;                      // left subtree pointer
       Node* right;                     // right subtree pointer
+      int count;                       // number of nodes in this subtree
+      int height;                      // height of this subtree, leaf is 1
    };
    Node* root;                         // root of the tree
+   Allocator<Node> nodes;              // where nodes are allocated from
+
+   // allocate a leaf node holding data
+   Node* newNode(ItemType*);
+   
+   // cached subtree data of current, 0 for an empty subtree
+   static int subtreeCount(const Node*);
+   static int subtreeHeight(const Node*);
+   
+   // well mixed hash of one item, so sums of them rarely collide
+   static unsigned long long itemDigest(const ItemType&);
+   
+   // recompute the cached subtree data of current from its children
+   static void updateNode(Node*);
 
    //   --------------------------------
    //      revursive helper functions
    //   --------------------------------
    
-   // helper for operator= and copy constructor
+   // helpers for operator= and copy constructor
+   void copyTree(const Node*);
    void copyHelper(Node* &, const Node*);
+   static Node* parallelCopyHelper(const Node*, Node**, int);
+   
+   // deletes every item below current, forking on large subtrees
+   static void deleteDataHelper(Node*, int);
+   
+   // helper for parallelReduce
+   template <typename Result, typename Map, typename Combine>
+   static Result reduceHelper(const Node*, const Result&, Map&, Combine&,
+                              int);
    
    // destructor/makeEmpty helper
    void makeEmptyHelper(Node*&);
    
-   // helper for operator==
-   bool equalityHelper(Node*, Node*) const;
-   
    // helper for insert
    bool insertHelper(ItemType*, Node*&);
    
    // helper for retrieve
    bool retrieveHelper(const ItemType&, ItemType*&, Node*) const;
    
-   // height recursive helper function
-   int heightHelper(Node*) const;
-   
-   int getCountHelper(Node*) const;
-   
-   // getHeightHelper is helper for getHeight,
-   // getNodeHeight is helper for getHeightHelper
-   int nodeHeightHelper(const ItemType &, Node*) const;
-   int getNodeHeight(Node*) const;
-   
    // erase recursive helper functions
    bool eraseHelper(Node*&, const ItemType&);
-   bool eraseRoot(Node*&);
+   void eraseRoot(Node*&);
    ItemType* findAndDeleteSmallest(Node*&);
    
    void removeLeavesHelper(Node*&);
@@ -145,8 +296,16 @@ private:
    // helper for bstreeToArray
    void bstreeToArrayHelper(ItemType* [], Node*, int &);
    
-   // helper for arrayToBSTree
-   void arrayToBSTreeHelper(ItemType* [], Node*&, int, int);
+   // helper for arrayToBSTree when the data cannot be linked directly
+   void arrayToBSTreeHelper(ItemType* [], int, int);
+
+   // true if a range of ItemType* is in strictly increasing order
+   template <typename ForwardIterator>
+   static bool isStrictlySorted(ForwardIterator, ForwardIterator);
+
+   // helper for arrayToBSTree and buildFromSorted
+   template <typename ForwardIterator>
+   Node* buildSortedHelper(ForwardIterator &, int);
    
    // helper for displaySideways
    void sideways(Node*, int) const;
@@ -156,22 +315,49 @@ private:
    
    int helper(Node* current, int n) const;
    
+   // helper for forEachInRange
+   template <typename Function>
+   void rangeHelper(const ItemType &, const ItemType &, Function &,
+                                                      Node*) const;
+   
+   // pushes current and its chain of left (or right) children onto path
+   static void pushLeftmost(vector<Node*> &, Node*);
+   static void pushRightmost(vector<Node*> &, Node*);
+   
+   // split and join primitives for the set operations
+   static Node* rotateLeft(Node*);
+   static Node* rotateRight(Node*);
+   static Node* join(Node*, Node*, Node*);
+   static Node* joinRight(Node*, Node*, Node*);
+   static Node* joinLeft(Node*, Node*, Node*);
+   static Node* concat(Node*, Node*);
+   static Node* splitLast(Node*, Node*&);
+   static void split(Node*, const ItemType&, Node*&, Node*&, Node*&);
+   
+   // set operation helpers, removed nodes are added to dropped
+   static const int PARALLEL_CUTOFF = 1 << 14;
+   static int forkDepth();
+   template <typename LeftTask, typename RightTask>
+   static void forkJoin(bool, LeftTask, RightTask);
+   static Node* unionHelper(Node*, Node*, vector<Node*>&, int);
+   static Node* intersectHelper(Node*, const Node*, vector<Node*>&, int);
+   static Node* differenceHelper(Node*, const Node*, vector<Node*>&, int);
+   void freeDropped(vector<Node*>&);
+   
 };
 
 //----------------------- Default Constructor --------------------------------
 // Preconditions:   None
 // Postconditions:  root is set to nullptr
-template <typename ItemType>
-BinTree<ItemType>::BinTree(string s) {
+template <typename ItemType, template <typename> class Allocator>
+BinTree<ItemType, Allocator>::BinTree(string s) {
    // if no constructor arguments are given
    if(s.length() == 0) {
       root = nullptr;
    }
    // if a string is given during intialization, create a new node/subtree
    else {
-      root = new Node;
-      root->data = new ItemType(s);
-      root->left = root->right = nullptr;
+      root = newNode(new ItemType(s));
    }
 }
 
@@ -182,8 +368,8 @@ BinTree<ItemType>::BinTree(string s) {
 // Preconditions:   this* BinTree is a Binary Search Tree
 // Postconditions:  *this is deallocated
 //                  root is null
-template <typename ItemType>
-BinTree<ItemType>::~BinTree() {
+template <typename ItemType, template <typename> class Allocator>
+BinTree<ItemType, Allocator>::~BinTree() {
    makeEmpty();
 }
 
@@ -194,10 +380,53 @@ BinTree<ItemType>::~BinTree() {
 // Preconditions:   this* BinTree is a Binary Search Tree
 // Postconditions:  *this is deallocated
 //                  root is null
-template <typename ItemType>
-void BinTree<ItemType>::makeEmpty() {
+template <typename ItemType, template <typename> class Allocator>
+void BinTree<ItemType, Allocator>::makeEmpty() {
+   int depth = forkDepth();
+   if(depth > 0 && subtreeCount(root) >= PARALLEL_CUTOFF) {
+      deleteDataHelper(root, depth);
+      if(Allocator<Node>::RELEASES_ALL) {
+         root = nullptr;               // release() below frees the nodes
+      }
+   }
    makeEmptyHelper(root);
+   nodes.release();     // hands every node block back at once
 }
+
+//---------------------------- deleteDataHelper ------------------------------
+// Description:
+// deletes the items of the subtree at current, the two children are done as
+// separate tasks while they are large and depth allows; nodes are left for
+// makeEmptyHelper or release() since the allocator is single threaded
+// Postconditions:  every data pointer below current is null
+template <typename ItemType, template <typename> class Allocator>
+void BinTree<ItemType, Allocator>::deleteDataHelper(Node* current,
+                                                    int depth) {
+   if(current == nullptr) {
+      return;
+   }
+   bool fork = depth > 0 && current->count >= PARALLEL_CUTOFF;
+   forkJoin(fork,
+            [=]() { deleteDataHelper(current->left, depth - 1); },
+            [=]() { deleteDataHelper(current->right, depth - 1); });
+   delete current->data;
+   current->data = nullptr;
+}
+
+//-------------------------------- newNode -----------------------------------
+// Description:
+// allocates a node from the allocator policy and makes it a leaf
+// Postconditions:  returns a node holding data with no children
+template <typename ItemType, template <typename> class Allocator>
+typename BinTree<ItemType, Allocator>::Node*
+BinTree<ItemType, Allocator>::newNode(ItemType* data) {
+   Node* node = nodes.allocate();
+   node->data = data;
+   node->left = node->right = nullptr;
+   node->count = node->height = 1;
+   return node;
+}
+
 //--------------------------- makeEmptyHelper --------------------------------
 // Description:
 // deallocates all memory in *this
@@ -205,8 +434,8 @@ void BinTree<ItemType>::makeEmpty() {
 //                  current is pointing to the root of *this BSTree
 // Postconditions:  *this is deallocated
 //                  root is null
-template <typename ItemType>
-void BinTree<ItemType>::makeEmptyHelper(Node*& current) {
+template <typename ItemType, template <typename> class Allocator>
+void BinTree<ItemType, Allocator>::makeEmptyHelper(Node*& current) {
    if(!current) {
       return;
    }
@@ -214,11 +443,14 @@ void BinTree<ItemType>::makeEmptyHelper(Node*& current) {
    makeEmptyHelper(current->left);
    makeEmptyHelper(current->right);
    
-   // delete node
+   // delete node, a pool that releases all of its nodes at once does not
+   // need them back one at a time
    delete current->data;
    current->data = nullptr;
    current->right = current->left = nullptr;
-   delete current;
+   if(!Allocator<Node>::RELEASES_ALL) {
+      nodes.deallocate(current);
+   }
    current = nullptr;
 }
 
@@ -227,9 +459,65 @@ void BinTree<ItemType>::makeEmptyHelper(Node*& current) {
 // deep copies a Binary Search Tree into *this
 // Preconditions:   BinTree right is a Binary Search Tree
 // Postconditions:  *this is a copy of BinTree right
-template <typename ItemType>
-BinTree<ItemType>::BinTree(const BinTree<ItemType>& right) {
-   copyHelper(root, right.root);
+template <typename ItemType, template <typename> class Allocator>
+BinTree<ItemType, Allocator>::BinTree(const BinTree& right) {
+   root = nullptr;
+   copyTree(right.root);
+}
+
+//------------------------------ copyTree ------------------------------------
+// Description:
+// copies the tree at source into the empty *this; large trees are copied by
+// parallelCopyHelper into nodes allocated up front
+// Preconditions:   root is null
+// Postconditions:  *this is a copy of the tree at source
+template <typename ItemType, template <typename> class Allocator>
+void BinTree<ItemType, Allocator>::copyTree(const Node* source) {
+   int depth = forkDepth();
+   int count = subtreeCount(source);
+   if(depth == 0 || count < PARALLEL_CUTOFF) {
+      copyHelper(root, source);
+      return;
+   }
+   vector<Node*> fresh(count);
+   for(int i = 0; i < count; i++) {
+      fresh[i] = nodes.allocate();
+   }
+   root = parallelCopyHelper(source, fresh.data(), depth);
+}
+
+//-------------------------- parallelCopyHelper ------------------------------
+// Description:
+// copies the subtree at source using fresh, which holds one node per item;
+// the node at inorder position i of the subtree is fresh[i], so the left
+// and right subtrees use disjoint parts of fresh and can be copied by
+// separate tasks
+// Postconditions:  returns the root of the copy
+template <typename ItemType, template <typename> class Allocator>
+typename BinTree<ItemType, Allocator>::Node*
+BinTree<ItemType, Allocator>::parallelCopyHelper(const Node* source,
+                                                 Node** fresh, int depth) {
+   if(source == nullptr) {
+      return nullptr;
+   }
+   int leftCount = subtreeCount(source->left);
+   Node* current = fresh[leftCount];
+   current->data = new ItemType(*source->data);
+   current->count = source->count;
+   current->height = source->height;
+
+   bool fork = depth > 0 && source->count >= PARALLEL_CUTOFF;
+   forkJoin(fork,
+            [=]() {
+               current->left = parallelCopyHelper(source->left, fresh,
+                                                  depth - 1);
+            },
+            [=]() {
+               current->right = parallelCopyHelper(source->right,
+                                                   fresh + leftCount + 1,
+                                                   depth - 1);
+            });
+   return current;
 }
 
 //---------------------------- copyHelper ------------------------------------
@@ -241,15 +529,16 @@ BinTree<ItemType>::BinTree(const BinTree<ItemType>& right) {
 //                  Node rightCurrent is pointing to the root of the the
 //                  BSTree to copy
 // Postconditions:  *this is a copy of BinTree right
-template <typename ItemType>
-void BinTree<ItemType>::copyHelper(Node* &current, const Node* rightCurrent) {
+template <typename ItemType, template <typename> class Allocator>
+void BinTree<ItemType, Allocator>::copyHelper(Node* &current,
+                                              const Node* rightCurrent) {
    // create node, then recurisvely move through the left and right subtrees
    // the right BSTree in a preorder traversal
    if(rightCurrent) {
       // create new node
-      current = new Node;
-      current->data = new ItemType(*rightCurrent->data);
-      current->left = current->right = nullptr;
+      current = newNode(new ItemType(*rightCurrent->data));
+      current->count = rightCurrent->count;
+      current->height = rightCurrent->height;
       
       // recursively traverse left and right subtrees
       copyHelper(current->left, rightCurrent->left);
@@ -262,50 +551,38 @@ void BinTree<ItemType>::copyHelper(Node* &current, const Node* rightCurrent) {
 // deep copies a Binary Search Tree into *this
 // Preconditions:   BinTree right is a Binary Search Tree
 // Postconditions:  *this is a copy of BinTree right
-template <typename ItemType>
-BinTree<ItemType>& BinTree<ItemType>::operator=(const BinTree<ItemType> &right) {
+template <typename ItemType, template <typename> class Allocator>
+BinTree<ItemType, Allocator>&
+BinTree<ItemType, Allocator>::operator=(const BinTree &right) {
    // if the right tree is the same as *this, return, else, copy right tree
    if(&right != this) {
       makeEmpty();
-      copyHelper(root, right.root);
+      copyTree(right.root);
    }
    return *this;
 }
 
 //----------------------------- operator== -----------------------------------
 // Description:
-// Determine if two BSTrees are equal
-// Preconditions:   *this and rightTree are binary search trees
-// Postconditions:  return true if trees have the same data
-//                  return false otherwise
-template <typename ItemType>
-bool BinTree<ItemType>::operator==(const BinTree<ItemType> & rightTree) const {
-   return equalityHelper(root, rightTree.root);
-}
-
-//---------------------------- equalityHelper --------------------------------
-// Description:
-// two binary trees are equal if they have the same data and structure
-// helper function for operator==
+// Determine if two BSTrees hold the same items; the shapes may differ.
+// Counts are compared first, then both trees are walked in order side by
+// side until the first item that differs
 // Preconditions:   *this and rightTree are binary search trees
 // Postconditions:  return true if trees have the same data
 //                  return false otherwise
-template <typename ItemType>
-bool BinTree<ItemType>::equalityHelper(Node* current, Node* rightCurrent) const {
-   // base case
-   if(!current && !rightCurrent) {
-      return true;
-   }
-   // if one tree has reached a leaf and the other has not, they are not equal
-   else if((current && !rightCurrent) || (!current && rightCurrent)) {
+template <typename ItemType, template <typename> class Allocator>
+bool BinTree<ItemType, Allocator>::operator==(const BinTree & rightTree) const {
+   if(getCount() != rightTree.getCount()) {
       return false;
    }
-   // if *this current node is != to the rightcurrent node, trees are unequal
-   else if(*current->data != *rightCurrent->data) {
-      return false;
+   const_iterator mine = begin();
+   const_iterator theirs = rightTree.begin();
+   for(; mine != end(); ++mine, ++theirs) {
+      if(*mine != *theirs) {
+         return false;
+      }
    }
-   return equalityHelper(current->left, rightCurrent->left);
-   return equalityHelper(current->right, rightCurrent->right);
+   return true;
 }
 
 //----------------------------- operator!= -----------------------------------
@@ -315,8 +592,8 @@ bool BinTree<ItemType>::equalityHelper(Node* current, Node* rightCurrent) const
 // Preconditions:   *this and rightTree are binary search trees
 // Postconditions:  return false if trees have the same data
 //                  return true otherwise
-template <typename ItemType>
-bool BinTree<ItemType>::operator!=(const BinTree<ItemType> & rightTree) const {
+template <typename ItemType, template <typename> class Allocator>
+bool BinTree<ItemType, Allocator>::operator!=(const BinTree & rightTree) const {
    return !(*this == rightTree);
 }
 
@@ -326,8 +603,8 @@ bool BinTree<ItemType>::operator!=(const BinTree<ItemType> & rightTree) const {
 // Preconditions:   none
 // Postconditions:  return true if tree is empty
 //                  return false otherwise
-template <typename ItemType>
-bool BinTree<ItemType>::isEmpty() const {
+template <typename ItemType, template <typename> class Allocator>
+bool BinTree<ItemType, Allocator>::isEmpty() const {
    return (root == nullptr);
 }
 
@@ -336,8 +613,8 @@ bool BinTree<ItemType>::isEmpty() const {
 // inserts a new node into the binary search tree
 // Preconditions:   ItemType newData has been allocated and holds a string
 // Postconditions:  the binary search tree has inserted a new leaf
-template <typename ItemType>
-bool BinTree<ItemType>::insert(ItemType* newData) {
+template <typename ItemType, template <typename> class Allocator>
+bool BinTree<ItemType, Allocator>::insert(ItemType* newData) {
    return insertHelper(newData, root);
 }
 
@@ -347,28 +624,34 @@ bool BinTree<ItemType>::insert(ItemType* newData) {
 // Preconditions:   ItemType newData has been allocated and holds a string
 //                  current is pointing to the root of *this BSTree
 // Postconditions:  the binary search tree has inserted a new leaf
-template <typename ItemType>
-bool BinTree<ItemType>::insertHelper(ItemType* newData, Node*& current) {
+template <typename ItemType, template <typename> class Allocator>
+bool BinTree<ItemType, Allocator>::insertHelper(ItemType* newData,
+                                                Node*& current) {
    // once we hit a leaf (bottom of the tree), insert the data
    if(current == nullptr) {
-      current = new Node;
-      current->data = newData;
-      current->left = current->right = nullptr;
+      current = newNode(newData);
       return true;
    }
+   
+   bool inserted;
    // if item is less than current item, insert in left subtree
-   else if(*current->data > *newData) {
-      return insertHelper(newData, current->left);
+   if(*current->data > *newData) {
+      inserted = insertHelper(newData, current->left);
    }
    // otherwise insert in right subtree
    else if(*current->data < *newData) {
-      return insertHelper(newData, current->right);
+      inserted = insertHelper(newData, current->right);
    }
    // if the ItemType is already in the tree (duplicate data), do not insert
    else {
       return false;
    }
-   return true;
+   
+   // the new leaf is below current, so current's subtree grew
+   if(inserted) {
+      updateNode(current);
+   }
+   return inserted;
 }
 
 //------------------------------- retrieve -----------------------------------
@@ -379,8 +662,9 @@ bool BinTree<ItemType>::insertHelper(ItemType* newData, Node*& current) {
 // Postconditions:  return true if the target ItemType was found and p is
 //                  pointing to the target data in the tree
 //                  return false otherwise
-template <typename ItemType>
-bool BinTree<ItemType>::retrieve(const ItemType & target, ItemType* & p) const {
+template <typename ItemType, template <typename> class Allocator>
+bool BinTree<ItemType, Allocator>::retrieve(const ItemType & target,
+                                            ItemType* & p) const {
    return retrieveHelper(target, p, root);
 }
 
@@ -393,9 +677,10 @@ bool BinTree<ItemType>::retrieve(const ItemType & target, ItemType* & p) const {
 // Postconditions:  return true if the target ItemType was found and p is
 //                  pointing to the target data in the tree
 //                  return false otherwise
-template <typename ItemType>
-bool BinTree<ItemType>::retrieveHelper(const ItemType & target, ItemType*& p,
-                                                       Node* current) const {
+template <typename ItemType, template <typename> class Allocator>
+bool BinTree<ItemType, Allocator>::retrieveHelper(const ItemType & target,
+                                                  ItemType*& p,
+                                                  Node* current) const {
    // base case
    if(!current) {
       return false;
@@ -420,42 +705,53 @@ bool BinTree<ItemType>::retrieveHelper(const ItemType & target, ItemType*& p,
 // If the node containing the item has two children, we must find a replacement
 // item to place in the node. This replacement item is either the largest
 // descendant of the left child or the smallest descendant of the right child
-// Precondition: root is not nullptr
+// Precondition: none
 // Postcondition: return true if the node with node with target input data has
 //                been erased
 //                return false otherwise
-template <typename ItemType>
-bool BinTree<ItemType>::erase(const ItemType& target) {
-   eraseHelper(root, target);
+template <typename ItemType, template <typename> class Allocator>
+bool BinTree<ItemType, Allocator>::erase(const ItemType& target) {
+   return eraseHelper(root, target);
 }
 
 //------------------------------- eraseHelper ---------------------------------
 // find the node with target data in the tree
 // return false if not found
-template <typename ItemType>
-bool BinTree<ItemType>::eraseHelper(Node*& current, const ItemType& target) {
+// every node on the path to an erased node has its cached data updated
+template <typename ItemType, template <typename> class Allocator>
+bool BinTree<ItemType, Allocator>::eraseHelper(Node*& current,
+                                               const ItemType& target) {
    if(current == nullptr) {
       return false;
    }
    else if(*current->data == target) {
-      return eraseRoot(current);
+      eraseRoot(current);
+      return true;
    }
-   else if(current->data < target) {
-      return eraseHelper(current->right);
+   
+   bool erased;
+   if(*current->data < target) {
+      erased = eraseHelper(current->right, target);
    }
    else {
-      return eraseHelper(current->left);
+      erased = eraseHelper(current->left, target);
    }
+   if(erased) {
+      updateNode(current);
+   }
+   return erased;
 }
 
 //------------------------------- eraseRoot -----------------------------------
-template <typename ItemType>
-bool BinTree<ItemType>::eraseRoot(Node*& current) {
+// deletes the node current points to and relinks its children
+// a node with two children takes the smallest item of its right subtree
+template <typename ItemType, template <typename> class Allocator>
+void BinTree<ItemType, Allocator>::eraseRoot(Node*& current) {
    if(!current->left && !current->right) {
       // delete the current nodes data
       delete current->data;
       current->data = nullptr;
-      delete current;
+      nodes.deallocate(current);
       current = nullptr;
    }
    else if(!current->right) {
@@ -466,7 +762,7 @@ bool BinTree<ItemType>::eraseRoot(Node*& current) {
       // delete the current node's data
       delete temp->data;
       temp->data = nullptr;
-      delete temp;
+      nodes.deallocate(temp);
       temp = nullptr;
    }
    else if(!current->left) {
@@ -477,62 +773,48 @@ bool BinTree<ItemType>::eraseRoot(Node*& current) {
       // delete the current node's data
       delete temp->data;
       temp->data = nullptr;
-      delete temp;
+      nodes.deallocate(temp);
       temp = nullptr;
    }
    else {
-      delete current->item;
-      root->item = findAndDeleteSmallest(current);
+      delete current->data;
+      current->data = findAndDeleteSmallest(current->right);
+      updateNode(current);
    }
 }
 
 //------------------------- findAndDeleteSmallest -----------------------------
-// finds and deletes the smallest node in the left subtree of the original
+// finds and deletes the smallest node in the right subtree of the original
 // target node that we want to delete
 // Postconditions: retuns the data (ItemType) that the samllest node in the
-//                 left subtree of the original target node stores
-template <typename ItemType>
-ItemType* BinTree<ItemType>::findAndDeleteSmallest(Node*& current) {
+//                 right subtree of the original target node stores
+template <typename ItemType, template <typename> class Allocator>
+ItemType* BinTree<ItemType, Allocator>::findAndDeleteSmallest(Node*& current) {
    if(current->left == nullptr) {
-      // create temporary data for the smallest node in the left subtree
+      // create temporary data for the smallest node in the right subtree
       ItemType* item = current->data;
       Node* temp = current;
       current = current->right;
       
-      // delete the smallest node in the left subtree
-      current->data = nullptr;
-      delete temp;
-      current = nullptr;
+      // delete the smallest node, its right subtree moves up
+      temp->data = nullptr;
+      nodes.deallocate(temp);
       return item;
    }
-   findAndDeleteSmallest(current->left);
+   ItemType* item = findAndDeleteSmallest(current->left);
+   updateNode(current);
+   return item;
 }
 
 //--------------------------------- height ------------------------------------
 // Description:
 // find the height of the current Binary Search Tree
-// Preconditions:   *this is either a binary tree or binary search tree
-//                  ItemType target has been allocated string data
-// Postconditions:  the height of the binary search tree is returned
-//                  return 0 if head is null
-template <typename ItemType>
-int BinTree<ItemType>::height() const {
-   return heightHelper(root);
-}
-
-//------------------------------ heightHelper ---------------------------------
-// Description:
-// find the height of the current Binary Search Tree
-// Preconditions:   *this is either a binary tree or binary search tree
-//                  ItemType target has been allocated string data
+// Preconditions:   none
 // Postconditions:  the height of the binary search tree is returned
-//                  return 0 if head is null
-template <typename ItemType>
-int BinTree<ItemType>::heightHelper(Node* current) const {
-   if(current == nullptr) {
-      return 0;
-   }
-   return 1 + max(heightHelper(current->left), heightHelper(current->right));
+//                  return 0 if root is null
+template <typename ItemType, template <typename> class Allocator>
+int BinTree<ItemType, Allocator>::height() const {
+   return subtreeHeight(root);
 }
 
 //------------------------------- getCount ------------------------------------
@@ -540,106 +822,173 @@ int BinTree<ItemType>::heightHelper(Node* current) const {
 // Find the total number of nodes in a binary search tree
 // Preconditions: none
 // Postconditions: return the number of nodes in the bstree
-template <typename ItemType>
-int BinTree<ItemType>::getCount() const {
-   return getCountHelper(root);
+template <typename ItemType, template <typename> class Allocator>
+int BinTree<ItemType, Allocator>::getCount() const {
+   return subtreeCount(root);
 }
 
-//----------------------------- getCountHelper --------------------------------
+//-------------------------------- digest -------------------------------------
 // Description:
-// Find the total number of nodes in a binary search tree
+// hash of the items in the tree, independent of its shape
 // Preconditions: none
-// Postconditions: return the number of nodes in the bstree
-template <typename ItemType>
-int BinTree<ItemType>::getCountHelper(Node* current) const {
-   if(current == nullptr) {
-      return 0;
+// Postconditions: equal trees return the same value, so replicas can be
+//                 compared by digest without sending their items
+template <typename ItemType, template <typename> class Allocator>
+unsigned long long BinTree<ItemType, Allocator>::digest() const {
+   unsigned long long sum = 0;
+   for(const ItemType& item : *this) {
+      sum += itemDigest(item);
    }
-   return getCountHelper(current->left) + getCountHelper(current->right) + 1;
+   return sum;
 }
-      
-//------------------------------- nodeHeight ----------------------------------
+
+//------------------------------- subtreeCount --------------------------------
 // Description:
-// find the height of a given value (ItemType) in the tree
-// Preconditions:   *this is either a binary tree or binary search tree
-//                  ItemType target has been allocated string data
-// Postconditions:  if the ItemType target is found, the height of the Node
-//                  is returned
-//                  return 0 otherwise (if target is not in tree/not found)
-// NOTE: The height of a node at a leaf is 1, height of a node at the next
-//          level is 2, and so on. The height of a value not found is zero.
-template <typename ItemType>
-int BinTree<ItemType>::nodeHeight(const ItemType &target) const {
-   return nodeHeightHelper(target, root);
+// number of nodes in the subtree rooted at current
+template <typename ItemType, template <typename> class Allocator>
+int BinTree<ItemType, Allocator>::subtreeCount(const Node* current) {
+   return (current == nullptr) ? 0 : current->count;
 }
- 
-//--------------------------- nodeHeightHelper --------------------------------
+
+//------------------------------- subtreeHeight -------------------------------
 // Description:
-// find the height of a given value (ItemType) in the tree
-// helper for getHeight
-// Preconditions:   *this is either a binary tree or binary search tree
-//                  ItemType target has been allocated string data
-// Postconditions:  if the ItemType target is found, the height of the Node
-//                  is returned
-//                  return 0 otherwise
-// NOTE: The height of a node at a leaf is 1, height of a node at the next
-//          level is 2, and so on. The height of a value not found is zero.
-template <typename ItemType>
-int BinTree<ItemType>::nodeHeightHelper(const ItemType &target, Node* current) const {
-   // base case
-   if(current == nullptr) {
-      return 0;
+// height of the subtree rooted at current
+template <typename ItemType, template <typename> class Allocator>
+int BinTree<ItemType, Allocator>::subtreeHeight(const Node* current) {
+   return (current == nullptr) ? 0 : current->height;
+}
+
+//-------------------------------- itemDigest ---------------------------------
+// Description:
+// std::hash of the item run through the splitmix64 finalizer; std::hash is
+// the identity for integers on common libraries, and plain sums of those
+// collide far too easily
+template <typename ItemType, template <typename> class Allocator>
+unsigned long long
+BinTree<ItemType, Allocator>::itemDigest(const ItemType& item) {
+   unsigned long long x = hash<ItemType>()(item);
+   x += 0x9e3779b97f4a7c15ULL;
+   x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+   x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+   return x ^ (x >> 31);
+}
+
+//-------------------------------- updateNode ---------------------------------
+// Description:
+// recompute the cached subtree data of current from its children
+// Preconditions:   the children of current are up to date
+// Postconditions:  current is up to date
+template <typename ItemType, template <typename> class Allocator>
+void BinTree<ItemType, Allocator>::updateNode(Node* current) {
+   current->count = subtreeCount(current->left) +
+                    subtreeCount(current->right) + 1;
+   current->height = 1 + max(subtreeHeight(current->left),
+                             subtreeHeight(current->right));
+}
+
+//--------------------------------- select ------------------------------------
+// Description:
+// find the item with exactly k smaller items in the tree, the left subtree
+// size tells whether it is to the left, at, or to the right of each node
+// Preconditions:   none
+// Postconditions:  return true and p is pointing to the item if
+//                  0 <= k < getCount(), return false otherwise
+template <typename ItemType, template <typename> class Allocator>
+bool BinTree<ItemType, Allocator>::select(int k, ItemType*& p) const {
+   if(k < 0 || k >= getCount()) {
+      return false;
    }
-   // target data is found
-   else if(*current->data == target) {
-      return getNodeHeight(current);
+   Node* current = root;
+   for(;;) {
+      int leftCount = subtreeCount(current->left);
+      if(k < leftCount) {
+         current = current->left;
+      }
+      else if(k == leftCount) {
+         p = current->data;
+         return true;
+      }
+      else {
+         // skip the left subtree and current
+         k -= leftCount + 1;
+         current = current->right;
+      }
    }
-   return max(nodeHeightHelper(target, current->left),
-              nodeHeightHelper(target, current->right));
 }
 
-//----------------------------- getNodeHeight --------------------------------
+//---------------------------------- rank -------------------------------------
+// Description:
+// count the items less than target; every time the descent goes right the
+// left subtree and the node itself are smaller than target
+// Preconditions:   none
+// Postconditions:  return the number of items less than target, which is
+//                  also the index select would use for target
+template <typename ItemType, template <typename> class Allocator>
+int BinTree<ItemType, Allocator>::rank(const ItemType& target) const {
+   int smaller = 0;
+   Node* current = root;
+   while(current != nullptr) {
+      if(*current->data < target) {
+         smaller += subtreeCount(current->left) + 1;
+         current = current->right;
+      }
+      else {
+         current = current->left;
+      }
+   }
+   return smaller;
+}
+      
+//------------------------------- nodeHeight ----------------------------------
 // Description:
-// need seperate method to count height starting from found node
-// helper for getHeightHelper
-// Preconditions:   Node* current is the Node of the target data if found in
-//                  getHeightHelper for getHeight
-// Postconditions:  the height of the target ItemType is returned
+// find the height of a given value (ItemType) in the tree
+// the target is found with a BST descent and its cached height is returned
+// Preconditions:   *this is a binary search tree
+//                  ItemType target has been allocated string data
+// Postconditions:  if the ItemType target is found, the height of the Node
+//                  is returned
+//                  return 0 otherwise (if target is not in tree/not found)
 // NOTE: The height of a node at a leaf is 1, height of a node at the next
 //          level is 2, and so on. The height of a value not found is zero.
-template <typename ItemType>
-int BinTree<ItemType>::getNodeHeight(Node* current) const {
-   if(current == nullptr) {
-      return 0;
+template <typename ItemType, template <typename> class Allocator>
+int BinTree<ItemType, Allocator>::nodeHeight(const ItemType &target) const {
+   Node* current = root;
+   while(current != nullptr) {
+      if(*current->data == target) {
+         return current->height;
+      }
+      current = (*current->data < target) ? current->right : current->left;
    }
-   // start counting height from leaf; takes the larger height of two subtrees
-   return 1 + max(getNodeHeight(current->left), getNodeHeight(current->right));
+   return 0;
 }
 
 //------------------------------ removeLeaves ---------------------------------
 // Description:
 // Removes all leaves in a BSTree
-template <typename ItemType>
-void BinTree<ItemType>::removeLeaves(){
+template <typename ItemType, template <typename> class Allocator>
+void BinTree<ItemType, Allocator>::removeLeaves(){
    removeLeavesHelper(root);
 }
 
 //--------------------------- removeLeavesHelper ------------------------------
 // Description:
 // Removes all leaves in a BSTree
-template <typename ItemType>
-void BinTree<ItemType>::removeLeavesHelper(Node*& current){
+// nodes that become leaves during the call are kept
+template <typename ItemType, template <typename> class Allocator>
+void BinTree<ItemType, Allocator>::removeLeavesHelper(Node*& current){
    if(current == nullptr){
         return;
     }
     else if(current->left == nullptr && current->right == nullptr){
         delete current->data;
         current->data = nullptr;
-        delete current;
+        nodes.deallocate(current);
         current = nullptr;
+        return;
     }
    removeLeavesHelper(current->left);
    removeLeavesHelper(current->right);
+   updateNode(current);
 }
  
 //----------------------------- bstreeToArray --------------------------------
@@ -655,8 +1004,8 @@ void BinTree<ItemType>::removeLeavesHelper(Node*& current){
 //                  should be empty and the array should be filled with:
 //      and, eee, ff, iii, jj, m, not, ooo, pp, r, sssss, tttt, y, z
 //                           (in this order)
-template <typename ItemType>
-void BinTree<ItemType>::bstreeToArray(ItemType* arrToFill[]) {
+template <typename ItemType, template <typename> class Allocator>
+void BinTree<ItemType, Allocator>::bstreeToArray(ItemType* arrToFill[]) {
    int subscript = 0;
    bstreeToArrayHelper(arrToFill, root, subscript);   // fill array
    makeEmpty();         // empty tree
@@ -679,17 +1028,19 @@ void BinTree<ItemType>::bstreeToArray(ItemType* arrToFill[]) {
 //                  should be empty and the array should be filled with:
 //      and, eee, ff, iii, jj, m, not, ooo, pp, r, sssss, tttt, y, z
 //                           (in this order)
-template <typename ItemType>
-void BinTree<ItemType>::bstreeToArrayHelper(ItemType* arrToFill[], Node* current,
-                                                                     int& index) {
+template <typename ItemType, template <typename> class Allocator>
+void BinTree<ItemType, Allocator>::bstreeToArrayHelper(ItemType* arrToFill[],
+                                           Node* current, int& index) {
    if(current == nullptr) {        // base case
       return;
    }
    
    bstreeToArrayHelper(arrToFill, current->left, index); // walk left subtree
    
-   // insert data from tree into array according to the index
-   arrToFill[index] = new ItemType(*current->data);
+   // move data from tree into array according to the index, the array
+   // owns it now so makeEmpty only deallocates the node
+   arrToFill[index] = current->data;
+   current->data = nullptr;
    index++;
    
    bstreeToArrayHelper(arrToFill, current->right, index); // walk right subtree
@@ -702,13 +1053,15 @@ void BinTree<ItemType>::bstreeToArrayHelper(ItemType* arrToFill[], Node* current
 // Preconditions:   The root in the array is at subscript 0
 //                  toCopy is an empty, partially filled, or full array of
 //                  ItemType*
-// Postconditions:  *this is a Binary Search Tree with data from the array of
-//                  ItemType* toCopy
+// Postconditions:  the data of the array of ItemType* toCopy is added to
+//                  *this, a duplicate of an item already there is deleted
 //                  the ItemType* array is filled with NULLs
 // NOTE: The root (recursively) is at (low+high)/2 where low is the lowest
-//       subscript of the array range and high is the highest.
-template <typename ItemType>
-void BinTree<ItemType>::arrayToBSTree(ItemType* arrToCopy[]) {
+//       subscript of the array range and high is the highest. An empty
+//       tree and strictly increasing data are linked in O(n), anything
+//       else is inserted one item at a time in the same order.
+template <typename ItemType, template <typename> class Allocator>
+void BinTree<ItemType, Allocator>::arrayToBSTree(ItemType* arrToCopy[]) {
    // see where the highest index in the array is with data initialized
    int low = 0, high = -1;
    for(int i = low; i < 100; i++) {
@@ -719,39 +1072,131 @@ void BinTree<ItemType>::arrayToBSTree(ItemType* arrToCopy[]) {
          break;
       }
    }
-   // if there is data initialized, convert it to a tree
-   if (high > -1) {
-      arrayToBSTreeHelper(arrToCopy, root, low, high);
+   // link the data into a tree, the tree owns the data now
+   if(isEmpty() && isStrictlySorted(arrToCopy + low, arrToCopy + high + 1)) {
+      buildFromSorted(arrToCopy + low, arrToCopy + high + 1);
+      for(int i = low; i <= high; i++) {
+         arrToCopy[i] = nullptr;
+      }
+   }
+   else {
+      arrayToBSTreeHelper(arrToCopy, low, high);
    }
 }
 
 //------------------------ arrayToBSTreeHelper -------------------------------
 // Description:
-// builds a balanced BinTree from a sorted array of ItemType*
-// Preconditions:   The root in the array is at subscript 0
-//                  toCopy is a non-empty, partially filled, or fully filled
-//                  array of ItemType*
-// Postconditions:  *this is a Binary Search Tree with data from the array of
-//                  ItemType* toCopy
-//                  the ItemType* array is filled with NULLs
-// NOTE: The root (recursively) is at (low+high)/2 where low is the lowest
-//       subscript of the array range and high is the highest.
-template <typename ItemType>
-void BinTree<ItemType>::arrayToBSTreeHelper(ItemType* arrToCopy[], Node*& current,
-                                                               int low, int high) {
-   // return if you've reached the beginning or end of the array (with data)
+// inserts the middle item of the subscript range, then the middle items of
+// both halves, so sorted data ends up balanced
+// Preconditions:   every subscript from low to high holds an ItemType*
+// Postconditions:  those subscripts are NULL, duplicates are deleted
+template <typename ItemType, template <typename> class Allocator>
+void BinTree<ItemType, Allocator>::arrayToBSTreeHelper(ItemType* arrToCopy[],
+                                                       int low, int high) {
    if(high < low) {
       return;
    }
-   
    int midpoint = (low + high) / 2;
+   if(!insert(arrToCopy[midpoint])) {
+      delete arrToCopy[midpoint];
+   }
+   arrToCopy[midpoint] = nullptr;
+   arrayToBSTreeHelper(arrToCopy, low, midpoint - 1);
+   arrayToBSTreeHelper(arrToCopy, midpoint + 1, high);
+}
+
+//---------------------------- isStrictlySorted ------------------------------
+// true if every ItemType* in [first, last) is less than the next one
+template <typename ItemType, template <typename> class Allocator>
+template <typename ForwardIterator>
+bool BinTree<ItemType, Allocator>::isStrictlySorted(ForwardIterator first,
+                                                    ForwardIterator last) {
+   return adjacent_find(first, last,
+                        [](const ItemType* left, const ItemType* right) {
+                           return !(*left < *right);
+                        }) == last;
+}
+
+//---------------------------- buildFromSorted -------------------------------
+// Description:
+// builds a balanced BinTree from a sorted range of ItemType*
+// Preconditions:   [first, last) is sorted by operator< with no duplicates,
+//                  checked by assert
+// Postconditions:  *this is a Binary Search Tree that owns the data in the
+//                  range, any previous contents are deallocated
+template <typename ItemType, template <typename> class Allocator>
+template <typename ForwardIterator>
+void BinTree<ItemType, Allocator>::buildFromSorted(ForwardIterator first,
+                                        ForwardIterator last) {
+   assert(isStrictlySorted(first, last));
+   makeEmpty();
+   int n = distance(first, last);
+   root = buildSortedHelper(first, n);
+}
+
+template <typename ItemType, template <typename> class Allocator>
+void BinTree<ItemType, Allocator>::buildFromSorted(
+                                       const vector<ItemType*>& sorted) {
+   buildFromSorted(sorted.begin(), sorted.end());
+}
+
+//--------------------------- buildSortedHelper ------------------------------
+// Description:
+// builds the left half, links the middle item, then builds the right half;
+// the range is consumed in order so each item is touched once
+// Preconditions:   next refers to the first of the n items of this subtree
+// Postconditions:  returns the root of a balanced subtree of the n items,
+//                  next is past the last item used
+template <typename ItemType, template <typename> class Allocator>
+template <typename ForwardIterator>
+typename BinTree<ItemType, Allocator>::Node*
+BinTree<ItemType, Allocator>::buildSortedHelper(ForwardIterator& next, int n) {
+   if(n <= 0) {
+      return nullptr;
+   }
+   // same split as (low + high) / 2 on a subscript range
+   int leftCount = (n - 1) / 2;
+   Node* leftSubtree = buildSortedHelper(next, leftCount);
    
-   // create new node (should already be at leaf, takes O(1) time)
-   insert(arrToCopy[midpoint]);
-   
-   // recursively walk through the array
-   arrayToBSTreeHelper(arrToCopy, current->left, low, midpoint - 1);
-   arrayToBSTreeHelper(arrToCopy, current->right, midpoint + 1, high);
+   Node* current = newNode(*next);
+   ++next;
+   current->left = leftSubtree;
+   current->right = buildSortedHelper(next, n - leftCount - 1);
+   updateNode(current);
+   return current;
+}
+
+//-------------------------------- extract -----------------------------------
+// Description:
+// moves the data out of the tree without copying it
+// Preconditions:   none
+// Postconditions:  returns the ItemType* of *this in sorted order, the caller
+//                  owns them; *this is empty
+template <typename ItemType, template <typename> class Allocator>
+vector<ItemType*> BinTree<ItemType, Allocator>::extract() {
+   vector<ItemType*> sorted;
+   sorted.reserve(getCount());
+   for(const_iterator it = begin(); it != end(); ++it) {
+      sorted.push_back(it.path.back()->data);
+      it.path.back()->data = nullptr;    // makeEmpty will not delete it
+   }
+   makeEmpty();
+   return sorted;
+}
+
+//----------------------------- toSortedVector -------------------------------
+// Description:
+// lists the data of the tree in sorted order without copying it
+// Postconditions:  returns pointers to the data of *this in sorted order,
+//                  they stay valid until the item is erased
+template <typename ItemType, template <typename> class Allocator>
+vector<const ItemType*> BinTree<ItemType, Allocator>::toSortedVector() const {
+   vector<const ItemType*> sorted;
+   sorted.reserve(getCount());
+   for(const_iterator it = begin(); it != end(); ++it) {
+      sorted.push_back(&*it);
+   }
+   return sorted;
 }
 
 //------------------------- displaySideways ----------------------------------
@@ -760,8 +1205,8 @@ void BinTree<ItemType>::arrayToBSTreeHelper(ItemType* arrToCopy[], Node*& curren
 // Preconditions:   NONE
 // Postconditions:  BinTree data has been output to the screen in a
 //                  sideways binary tree
-template <typename ItemType>
-void BinTree<ItemType>::displaySideways() const {
+template <typename ItemType, template <typename> class Allocator>
+void BinTree<ItemType, Allocator>::displaySideways() const {
    sideways(root, 0);
 }
 
@@ -772,8 +1217,8 @@ void BinTree<ItemType>::displaySideways() const {
 //                  the level of the root is 1
 // Postconditions:  BinTree data has been output to the screen in a
 //                  sideways binary tree
-template <typename ItemType>
-void BinTree<ItemType>::sideways(Node* current, int level) const {
+template <typename ItemType, template <typename> class Allocator>
+void BinTree<ItemType, Allocator>::sideways(Node* current, int level) const {
    if(!current) {                     // base case
       return;
    }
@@ -796,8 +1241,9 @@ void BinTree<ItemType>::sideways(Node* current, int level) const {
 // Preconditions:   current is pointing to the root of the *this BSTree
 //                  ItemType class is responsible for displaying its own data
 // Postconditions:  each node in *this BSTree is output onto the screen
-template <typename ItemType>
-ostream& BinTree<ItemType>::inorderHelper(ostream& output, Node* current) const {
+template <typename ItemType, template <typename> class Allocator>
+ostream& BinTree<ItemType, Allocator>::inorderHelper(ostream& output,
+                                                   Node* current) const {
    if(!current) {
       return output;
    }
@@ -807,4 +1253,638 @@ ostream& BinTree<ItemType>::inorderHelper(ostream& output, Node* current) const
    return output;
 }
 
+//------------------------------ pushLeftmost -------------------------------
+// Description:
+// pushes current and then every left child below it onto the path; the last
+// node pushed is the smallest item in current's subtree
+template <typename ItemType, template <typename> class Allocator>
+void BinTree<ItemType, Allocator>::pushLeftmost(vector<Node*>& path,
+                                                Node* current) {
+   while(current != nullptr) {
+      path.push_back(current);
+      current = current->left;
+   }
+}
+
+//----------------------------- pushRightmost -------------------------------
+// Description:
+// pushes current and then every right child below it onto the path; the
+// last node pushed is the largest item in current's subtree
+template <typename ItemType, template <typename> class Allocator>
+void BinTree<ItemType, Allocator>::pushRightmost(vector<Node*>& path,
+                                                 Node* current) {
+   while(current != nullptr) {
+      path.push_back(current);
+      current = current->right;
+   }
+}
+
+//--------------------------- iterator operator++ ----------------------------
+// Description:
+// moves to the inorder successor
+// Preconditions:   the iterator is not at end
+// Postconditions:  the iterator is at the next larger item, or at end
+template <typename ItemType, template <typename> class Allocator>
+typename BinTree<ItemType, Allocator>::const_iterator&
+BinTree<ItemType, Allocator>::const_iterator::operator++() {
+   Node* current = path.back();
+   if(current->right != nullptr) {
+      // successor is the smallest item of the right subtree
+      pushLeftmost(path, current->right);
+   }
+   else {
+      // climb until we come up out of a left subtree
+      path.pop_back();
+      while(!path.empty() && path.back()->right == current) {
+         current = path.back();
+         path.pop_back();
+      }
+   }
+   return *this;
+}
+
+//--------------------------- iterator operator-- ----------------------------
+// Description:
+// moves to the inorder predecessor, --end() is the largest item
+// Preconditions:   the iterator is not at begin
+// Postconditions:  the iterator is at the next smaller item
+template <typename ItemType, template <typename> class Allocator>
+typename BinTree<ItemType, Allocator>::const_iterator&
+BinTree<ItemType, Allocator>::const_iterator::operator--() {
+   if(path.empty()) {
+      pushRightmost(path, tree->root);
+      return *this;
+   }
+   Node* current = path.back();
+   if(current->left != nullptr) {
+      // predecessor is the largest item of the left subtree
+      pushRightmost(path, current->left);
+   }
+   else {
+      // climb until we come up out of a right subtree
+      path.pop_back();
+      while(!path.empty() && path.back()->left == current) {
+         current = path.back();
+         path.pop_back();
+      }
+   }
+   return *this;
+}
+
+//------------------------------- begin/end ----------------------------------
+// Description:
+// begin is the smallest item, end is one past the largest item
+template <typename ItemType, template <typename> class Allocator>
+typename BinTree<ItemType, Allocator>::const_iterator
+BinTree<ItemType, Allocator>::begin() const {
+   const_iterator it;
+   it.tree = this;
+   pushLeftmost(it.path, root);
+   return it;
+}
+
+template <typename ItemType, template <typename> class Allocator>
+typename BinTree<ItemType, Allocator>::const_iterator
+BinTree<ItemType, Allocator>::end() const {
+   const_iterator it;
+   it.tree = this;
+   return it;
+}
+
+//------------------------------- lowerBound ---------------------------------
+// Description:
+// finds the first item that is not less than target with one descent
+// Postconditions:  returns end() if every item is less than target
+template <typename ItemType, template <typename> class Allocator>
+typename BinTree<ItemType, Allocator>::const_iterator
+BinTree<ItemType, Allocator>::lowerBound(const ItemType& target) const {
+   const_iterator it;
+   it.tree = this;
+   int found = 0;                    // path length up to the best candidate
+   Node* current = root;
+   while(current != nullptr) {
+      it.path.push_back(current);
+      if(*current->data < target) {
+         current = current->right;
+      }
+      else {
+         found = it.path.size();
+         current = current->left;
+      }
+   }
+   it.path.resize(found);
+   return it;
+}
+
+//------------------------------- upperBound ---------------------------------
+// Description:
+// finds the first item that is greater than target with one descent
+// Postconditions:  returns end() if no item is greater than target
+template <typename ItemType, template <typename> class Allocator>
+typename BinTree<ItemType, Allocator>::const_iterator
+BinTree<ItemType, Allocator>::upperBound(const ItemType& target) const {
+   const_iterator it;
+   it.tree = this;
+   int found = 0;                    // path length up to the best candidate
+   Node* current = root;
+   while(current != nullptr) {
+      it.path.push_back(current);
+      if(*current->data > target) {
+         found = it.path.size();
+         current = current->left;
+      }
+      else {
+         current = current->right;
+      }
+   }
+   it.path.resize(found);
+   return it;
+}
+
+//------------------------------- equalRange ---------------------------------
+// Description:
+// returns [lowerBound(target), upperBound(target))
+template <typename ItemType, template <typename> class Allocator>
+pair<typename BinTree<ItemType, Allocator>::const_iterator,
+     typename BinTree<ItemType, Allocator>::const_iterator>
+BinTree<ItemType, Allocator>::equalRange(const ItemType& target) const {
+   return make_pair(lowerBound(target), upperBound(target));
+}
+
+//----------------------------- forEachInRange -------------------------------
+// Description:
+// calls fn(const ItemType&) on each item between lo and hi (inclusive)
+// in sorted order
+// Preconditions:   lo <= hi
+// Postconditions:  only subtrees that overlap [lo, hi] are visited
+template <typename ItemType, template <typename> class Allocator>
+template <typename Function>
+void BinTree<ItemType, Allocator>::forEachInRange(const ItemType& lo,
+                                                  const ItemType& hi,
+                                                  Function fn) const {
+   rangeHelper(lo, hi, fn, root);
+}
+
+//------------------------------- rangeHelper --------------------------------
+// Description:
+// inorder walk that skips the left subtree when current is below lo and the
+// right subtree when current is above hi
+template <typename ItemType, template <typename> class Allocator>
+template <typename Function>
+void BinTree<ItemType, Allocator>::rangeHelper(const ItemType& lo,
+                                               const ItemType& hi,
+                                               Function& fn,
+                                               Node* current) const {
+   if(current == nullptr) {
+      return;
+   }
+   bool aboveLo = *current->data >= lo;
+   bool belowHi = *current->data <= hi;
+   if(aboveLo) {
+      rangeHelper(lo, hi, fn, current->left);
+   }
+   if(aboveLo && belowHi) {
+      fn(static_cast<const ItemType&>(*current->data));
+   }
+   if(belowHi) {
+      rangeHelper(lo, hi, fn, current->right);
+   }
+}
+
+//--------------------------------- unionWith ---------------------------------
+// Description:
+// merges the other tree into *this; other's nodes are taken over along with
+// its allocator blocks, so no item is copied
+// Preconditions:   other uses the same item type and allocator
+// Postconditions:  *this holds every item of both trees, an item in both
+//                  keeps the copy from *this; other is empty
+template <typename ItemType, template <typename> class Allocator>
+void BinTree<ItemType, Allocator>::unionWith(BinTree& other) {
+   if(&other == this) {
+      return;
+   }
+   nodes.absorb(other.nodes);
+   vector<Node*> dropped;
+   root = unionHelper(root, other.root, dropped, forkDepth());
+   other.root = nullptr;
+   freeDropped(dropped);
+}
+
+//------------------------------- intersectWith -------------------------------
+// Description:
+// keeps the items of *this that are also in other; other is only read
+// Postconditions:  *this holds the items found in both trees
+template <typename ItemType, template <typename> class Allocator>
+void BinTree<ItemType, Allocator>::intersectWith(const BinTree& other) {
+   if(&other == this) {
+      return;
+   }
+   vector<Node*> dropped;
+   root = intersectHelper(root, other.root, dropped, forkDepth());
+   freeDropped(dropped);
+}
+
+//-------------------------------- difference ---------------------------------
+// Description:
+// removes the items of *this that are also in other; other is only read
+// Postconditions:  *this holds the items not found in other
+template <typename ItemType, template <typename> class Allocator>
+void BinTree<ItemType, Allocator>::difference(const BinTree& other) {
+   if(&other == this) {
+      makeEmpty();
+      return;
+   }
+   vector<Node*> dropped;
+   root = differenceHelper(root, other.root, dropped, forkDepth());
+   freeDropped(dropped);
+}
+
+//-------------------------------- freeDropped --------------------------------
+// Description:
+// deletes the data of nodes removed by a set operation and gives the nodes
+// back to the allocator
+template <typename ItemType, template <typename> class Allocator>
+void BinTree<ItemType, Allocator>::freeDropped(vector<Node*>& dropped) {
+   for(Node* node : dropped) {
+      delete node->data;
+      node->data = nullptr;
+      nodes.deallocate(node);
+   }
+   dropped.clear();
+}
+
+//--------------------------------- forkDepth ---------------------------------
+// Description:
+// levels of recursion that may fork, enough for a task per hardware thread
+template <typename ItemType, template <typename> class Allocator>
+int BinTree<ItemType, Allocator>::forkDepth() {
+   unsigned threads = thread::hardware_concurrency();
+   int depth = 0;
+   while((1u << depth) < threads) {
+      depth++;
+   }
+   return depth;
+}
+
+//---------------------------------- forkJoin ---------------------------------
+// Description:
+// runs left as a separate task and right on this thread when fork is true,
+// otherwise runs both here; returns when both are done
+template <typename ItemType, template <typename> class Allocator>
+template <typename LeftTask, typename RightTask>
+void BinTree<ItemType, Allocator>::forkJoin(bool fork, LeftTask left,
+                                            RightTask right) {
+   if(fork) {
+      future<void> task = async(launch::async, left);
+      right();
+      task.get();
+   }
+   else {
+      left();
+      right();
+   }
+}
+
+//------------------------------ parallelReduce -------------------------------
+// Description:
+// folds the items in order: the result of a subtree is
+// combine(combine(left result, map(item)), right result), and an empty
+// subtree gives identity. Large subtrees reduce their children as separate
+// tasks, so map and combine must be safe to call from several threads
+// Preconditions:   combine is associative and identity is its identity
+// Postconditions:  returns the fold of every item, identity if empty
+template <typename ItemType, template <typename> class Allocator>
+template <typename Result, typename Map, typename Combine>
+Result BinTree<ItemType, Allocator>::parallelReduce(Result identity, Map map,
+                                                    Combine combine) const {
+   return reduceHelper(root, identity, map, combine, forkDepth());
+}
+
+template <typename ItemType, template <typename> class Allocator>
+template <typename Result, typename Map, typename Combine>
+Result BinTree<ItemType, Allocator>::reduceHelper(const Node* current,
+                                                  const Result& identity,
+                                                  Map& map, Combine& combine,
+                                                  int depth) {
+   if(current == nullptr) {
+      return identity;
+   }
+   Result left = identity;
+   Result right = identity;
+   bool fork = depth > 0 && current->count >= PARALLEL_CUTOFF;
+   forkJoin(fork,
+            [&]() {
+               left = reduceHelper(current->left, identity, map, combine,
+                                   depth - 1);
+            },
+            [&]() {
+               right = reduceHelper(current->right, identity, map, combine,
+                                    depth - 1);
+            });
+   Result middle = map(static_cast<const ItemType&>(*current->data));
+   return combine(combine(left, middle), right);
+}
+
+//------------------------------- unionHelper ---------------------------------
+// Description:
+// splits b around the root of a, unions the matching halves and joins them
+// back under a's root; b's copy of a's root item is dropped
+template <typename ItemType, template <typename> class Allocator>
+typename BinTree<ItemType, Allocator>::Node*
+BinTree<ItemType, Allocator>::unionHelper(Node* a, Node* b,
+                                          vector<Node*>& dropped, int depth) {
+   if(a == nullptr) {
+      return b;
+   }
+   if(b == nullptr) {
+      return a;
+   }
+   bool fork = depth > 0 && a->count + b->count >= PARALLEL_CUTOFF;
+   Node* bLess;
+   Node* bMatch;
+   Node* bGreater;
+   split(b, *a->data, bLess, bMatch, bGreater);
+   if(bMatch != nullptr) {
+      dropped.push_back(bMatch);
+   }
+
+   Node* left;
+   Node* right;
+   if(fork) {
+      vector<Node*> leftDropped;
+      Node* aLeft = a->left;
+      future<Node*> task = async(launch::async, [&]() {
+         return unionHelper(aLeft, bLess, leftDropped, depth - 1);
+      });
+      right = unionHelper(a->right, bGreater, dropped, depth - 1);
+      left = task.get();
+      dropped.insert(dropped.end(), leftDropped.begin(), leftDropped.end());
+   }
+   else {
+      left = unionHelper(a->left, bLess, dropped, 0);
+      right = unionHelper(a->right, bGreater, dropped, 0);
+   }
+   return join(left, a, right);
+}
+
+//----------------------------- intersectHelper -------------------------------
+// Description:
+// splits a around the root of b and intersects the matching halves; a's
+// item equal to b's root, if any, joins them back, otherwise they are
+// concatenated. a subtree of a facing an empty part of b is dropped whole
+template <typename ItemType, template <typename> class Allocator>
+typename BinTree<ItemType, Allocator>::Node*
+BinTree<ItemType, Allocator>::intersectHelper(Node* a, const Node* b,
+                                          vector<Node*>& dropped, int depth) {
+   if(a == nullptr) {
+      return nullptr;
+   }
+   if(b == nullptr) {
+      vector<Node*> path;
+      path.push_back(a);
+      while(!path.empty()) {
+         Node* current = path.back();
+         path.pop_back();
+         if(current->left != nullptr) {
+            path.push_back(current->left);
+         }
+         if(current->right != nullptr) {
+            path.push_back(current->right);
+         }
+         dropped.push_back(current);
+      }
+      return nullptr;
+   }
+   bool fork = depth > 0 && a->count + b->count >= PARALLEL_CUTOFF;
+   Node* aLess;
+   Node* aMatch;
+   Node* aGreater;
+   split(a, *b->data, aLess, aMatch, aGreater);
+
+   Node* left;
+   Node* right;
+   if(fork) {
+      vector<Node*> leftDropped;
+      future<Node*> task = async(launch::async, [&]() {
+         return intersectHelper(aLess, b->left, leftDropped, depth - 1);
+      });
+      right = intersectHelper(aGreater, b->right, dropped, depth - 1);
+      left = task.get();
+      dropped.insert(dropped.end(), leftDropped.begin(), leftDropped.end());
+   }
+   else {
+      left = intersectHelper(aLess, b->left, dropped, 0);
+      right = intersectHelper(aGreater, b->right, dropped, 0);
+   }
+   return (aMatch != nullptr) ? join(left, aMatch, right)
+                              : concat(left, right);
+}
+
+//----------------------------- differenceHelper ------------------------------
+// Description:
+// splits a around the root of b, subtracts the matching halves of b and
+// concatenates the results; a's item equal to b's root is dropped
+template <typename ItemType, template <typename> class Allocator>
+typename BinTree<ItemType, Allocator>::Node*
+BinTree<ItemType, Allocator>::differenceHelper(Node* a, const Node* b,
+                                          vector<Node*>& dropped, int depth) {
+   if(a == nullptr || b == nullptr) {
+      return a;
+   }
+   bool fork = depth > 0 && a->count + b->count >= PARALLEL_CUTOFF;
+   Node* aLess;
+   Node* aMatch;
+   Node* aGreater;
+   split(a, *b->data, aLess, aMatch, aGreater);
+   if(aMatch != nullptr) {
+      dropped.push_back(aMatch);
+   }
+
+   Node* left;
+   Node* right;
+   if(fork) {
+      vector<Node*> leftDropped;
+      future<Node*> task = async(launch::async, [&]() {
+         return differenceHelper(aLess, b->left, leftDropped, depth - 1);
+      });
+      right = differenceHelper(aGreater, b->right, dropped, depth - 1);
+      left = task.get();
+      dropped.insert(dropped.end(), leftDropped.begin(), leftDropped.end());
+   }
+   else {
+      left = differenceHelper(aLess, b->left, dropped, 0);
+      right = differenceHelper(aGreater, b->right, dropped, 0);
+   }
+   return concat(left, right);
+}
+
+//----------------------------------- split -----------------------------------
+// Description:
+// splits the tree at current into the nodes less than key and the nodes
+// greater than key; the nodes on the search path are joined onto the side
+// they belong to on the way back up
+// Postconditions:  less and greater are balanced trees, match is the
+//                  detached node equal to key or nullptr
+template <typename ItemType, template <typename> class Allocator>
+void BinTree<ItemType, Allocator>::split(Node* current, const ItemType& key,
+                                         Node*& less, Node*& match,
+                                         Node*& greater) {
+   if(current == nullptr) {
+      less = match = greater = nullptr;
+   }
+   else if(key < *current->data) {
+      Node* rest;
+      split(current->left, key, less, match, rest);
+      greater = join(rest, current, current->right);
+   }
+   else if(*current->data < key) {
+      Node* rest;
+      split(current->right, key, rest, match, greater);
+      less = join(current->left, current, rest);
+   }
+   else {
+      less = current->left;
+      greater = current->right;
+      match = current;
+      match->left = match->right = nullptr;
+      updateNode(match);
+   }
+}
+
+//------------------------------------ join -----------------------------------
+// Description:
+// links left, middle and right into one tree, where every item of left is
+// less than middle's and every item of right is greater. When the heights
+// differ by more than one, middle goes down the spine of the taller tree to
+// a subtree of about the other tree's height and rotations rebalance it
+// Postconditions:  returns the root of the joined tree, O(height difference)
+template <typename ItemType, template <typename> class Allocator>
+typename BinTree<ItemType, Allocator>::Node*
+BinTree<ItemType, Allocator>::join(Node* left, Node* middle, Node* right) {
+   if(subtreeHeight(left) > subtreeHeight(right) + 1) {
+      return joinRight(left, middle, right);
+   }
+   if(subtreeHeight(right) > subtreeHeight(left) + 1) {
+      return joinLeft(left, middle, right);
+   }
+   middle->left = left;
+   middle->right = right;
+   updateNode(middle);
+   return middle;
+}
+
+//--------------------------------- joinRight ---------------------------------
+// Description:
+// join when left is the taller tree, goes down its right spine
+template <typename ItemType, template <typename> class Allocator>
+typename BinTree<ItemType, Allocator>::Node*
+BinTree<ItemType, Allocator>::joinRight(Node* left, Node* middle,
+                                        Node* right) {
+   if(subtreeHeight(left->right) <= subtreeHeight(right) + 1) {
+      middle->left = left->right;
+      middle->right = right;
+      updateNode(middle);
+      if(middle->height <= subtreeHeight(left->left) + 1) {
+         left->right = middle;
+         updateNode(left);
+         return left;
+      }
+      left->right = rotateRight(middle);
+      updateNode(left);
+      return rotateLeft(left);
+   }
+   left->right = joinRight(left->right, middle, right);
+   updateNode(left);
+   if(left->right->height <= subtreeHeight(left->left) + 1) {
+      return left;
+   }
+   return rotateLeft(left);
+}
+
+//---------------------------------- joinLeft ---------------------------------
+// Description:
+// join when right is the taller tree, mirror image of joinRight
+template <typename ItemType, template <typename> class Allocator>
+typename BinTree<ItemType, Allocator>::Node*
+BinTree<ItemType, Allocator>::joinLeft(Node* left, Node* middle,
+                                       Node* right) {
+   if(subtreeHeight(right->left) <= subtreeHeight(left) + 1) {
+      middle->left = left;
+      middle->right = right->left;
+      updateNode(middle);
+      if(middle->height <= subtreeHeight(right->right) + 1) {
+         right->left = middle;
+         updateNode(right);
+         return right;
+      }
+      right->left = rotateLeft(middle);
+      updateNode(right);
+      return rotateRight(right);
+   }
+   right->left = joinLeft(left, middle, right->left);
+   updateNode(right);
+   if(right->left->height <= subtreeHeight(right->right) + 1) {
+      return right;
+   }
+   return rotateRight(right);
+}
+
+//---------------------------------- concat -----------------------------------
+// Description:
+// join without a middle node: the largest node of left is taken out and
+// used as the middle
+template <typename ItemType, template <typename> class Allocator>
+typename BinTree<ItemType, Allocator>::Node*
+BinTree<ItemType, Allocator>::concat(Node* left, Node* right) {
+   if(left == nullptr) {
+      return right;
+   }
+   Node* last;
+   Node* rest = splitLast(left, last);
+   return join(rest, last, right);
+}
+
+//--------------------------------- splitLast ---------------------------------
+// Description:
+// detaches the largest node of the tree at current
+// Postconditions:  returns the rest of the tree, last is the detached node
+template <typename ItemType, template <typename> class Allocator>
+typename BinTree<ItemType, Allocator>::Node*
+BinTree<ItemType, Allocator>::splitLast(Node* current, Node*& last) {
+   if(current->right == nullptr) {
+      last = current;
+      return current->left;
+   }
+   Node* rest = splitLast(current->right, last);
+   return join(current->left, current, rest);
+}
+
+//------------------------------ rotateLeft -----------------------------------
+// Description:
+// current's right child becomes the root of the subtree
+template <typename ItemType, template <typename> class Allocator>
+typename BinTree<ItemType, Allocator>::Node*
+BinTree<ItemType, Allocator>::rotateLeft(Node* current) {
+   Node* newRoot = current->right;
+   current->right = newRoot->left;
+   newRoot->left = current;
+   updateNode(current);
+   updateNode(newRoot);
+   return newRoot;
+}
+
+//------------------------------ rotateRight ----------------------------------
+// Description:
+// current's left child becomes the root of the subtree
+template <typename ItemType, template <typename> class Allocator>
+typename BinTree<ItemType, Allocator>::Node*
+BinTree<ItemType, Allocator>::rotateRight(Node* current) {
+   Node* newRoot = current->left;
+   current->left = newRoot->right;
+   newRoot->right = current;
+   updateNode(current);
+   updateNode(newRoot);
+   return newRoot;
+}
+
 #endif
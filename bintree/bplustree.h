@@ -0,0 +1,765 @@
+// ------------------------------- BPlusTree.h -------------------------------
+
+// CSS 343
+// Created: October 19th, 2026
+// Last Modified: October 19th, 2026
+
+// ---------------------------------------------------------------------------
+
+// BPlusTree class:  An in-memory B+tree that can be used in place of BinTree
+//                   as an ordered index.
+//                   - Every node holds many keys, so one node fetch replaces
+//                     several levels of a binary tree.
+//                   - Keys are stored inline in the nodes instead of behind
+//                     an ItemType*, so a lookup does not need a second fetch
+//                     to reach the data.
+//                   - All data lives in the leaves; the leaves are linked in
+//                     sorted order for ordered iteration and range scans.
+
+// ---------------------------------------------------------------------------
+
+// Notes on specifications, special algorithms, and assumptions.
+
+//   -- exposes the insert/retrieve/erase/ordered output API of BinTree
+//   -- ItemType must be default constructible and assignable, and must
+//      provide operator< and operator==
+//   -- insert takes ownership of the ItemType* like BinTree does, but the
+//      value is moved into a leaf and the pointer is deleted right away;
+//      a duplicate is not inserted and stays with the caller, as in BinTree
+//    - the pointer handed out by retrieve points into a leaf and is only
+//      valid until the next insert, erase or makeEmpty
+//   -- node sizes are chosen from NODE_BYTES so a node spans a few cache
+//      lines; small keys get wide nodes, large keys get at least 4 per node
+//   -- leaves hold between LEAF_ORDER/2 and LEAF_ORDER keys and inner nodes
+//      between INNER_ORDER/2 and INNER_ORDER keys, except for the root
+//   -- An empty tree has 0 nodes and height 0; a tree that is one leaf has
+//      height 1
+
+// ---------------------------------------------------------------------------
+
+#ifndef BPLUSTREE_H
+#define BPLUSTREE_H
+#include <iostream>
+#include <algorithm>
+#include <utility>
+using namespace std;
+
+template <typename ItemType>
+class BPlusTree {
+//--------------------------- operator<< ------------------------------------
+// Description:
+// displays the tree in sorted order by walking the linked leaves
+// Preconditions:   ItemType class is responsible for displaying its own data
+// Postconditions:  each item in *this BPlusTree is output onto the screen
+friend ostream& operator<<(ostream& output, const BPlusTree<ItemType>& tree) {
+   for(const_iterator it = tree.begin(); it != tree.end(); ++it) {
+      output << *it << " ";
+   }
+   output << endl;
+   return output;
+}
+
+private:
+   struct Leaf;
+
+public:
+   BPlusTree();                   // constructor
+   BPlusTree(const BPlusTree &);  // copy constructor
+   ~BPlusTree();                  // destructor, calls makeEmpty
+
+   // overloaded operators
+   BPlusTree& operator=(const BPlusTree &);
+   bool operator==(const BPlusTree &) const;
+   bool operator!=(const BPlusTree &) const;
+
+   // make the tree empty so isEmpty returns true
+   void makeEmpty();
+
+   // true if tree is empty, otherwise false
+   bool isEmpty() const;
+
+   // true if the item is inserted and the pointer deleted, false if it is
+   // a duplicate, which the caller still owns
+   bool insert(ItemType*);
+
+   // retrieve an item based on ItemType from the tree
+   bool retrieve(const ItemType &, ItemType* &) const;
+
+   // remove an item based on ItemType from the tree
+   bool erase(const ItemType &);
+
+   // get the number of levels in the tree
+   int height() const;
+
+   // get the total number of items in the tree
+   int getCount() const;
+
+   // forward iterator over the items in sorted order
+   class const_iterator {
+   public:
+      const_iterator() : leaf(nullptr), index(0) {}
+      const ItemType& operator*() const { return leaf->keys[index]; }
+      const ItemType* operator->() const { return &leaf->keys[index]; }
+      const_iterator& operator++() {
+         if(++index == leaf->count) {
+            leaf = leaf->next;
+            index = 0;
+         }
+         return *this;
+      }
+      const_iterator operator++(int) {
+         const_iterator old = *this;
+         ++*this;
+         return old;
+      }
+      bool operator==(const const_iterator& rhs) const {
+         return leaf == rhs.leaf && index == rhs.index;
+      }
+      bool operator!=(const const_iterator& rhs) const {
+         return !(*this == rhs);
+      }
+   private:
+      friend class BPlusTree;
+      const_iterator(const Leaf* l, int i) : leaf(l), index(i) {}
+      const Leaf* leaf;
+      int index;
+   };
+
+   const_iterator begin() const;
+   const_iterator end() const;
+
+   // first item that is not less than the target
+   const_iterator lowerBound(const ItemType &) const;
+
+private:
+   // target size of one node; the number of keys per node is derived from it
+   static const int NODE_BYTES = 256;
+   static const int LEAF_ORDER = (NODE_BYTES / (int)sizeof(ItemType) > 4) ?
+                                  NODE_BYTES / (int)sizeof(ItemType) : 4;
+   static const int INNER_ORDER = (NODE_BYTES /
+                           (int)(sizeof(ItemType) + sizeof(void*)) > 4) ?
+                           NODE_BYTES / (int)(sizeof(ItemType) + sizeof(void*))
+                           : 4;
+
+   struct Node {
+      bool isLeaf;                       // leaves hold data, inner nodes keys
+      int count;                         // number of keys in use
+   };
+   struct Leaf : Node {
+      ItemType keys[LEAF_ORDER];         // sorted data, stored inline
+      Leaf* next;                        // next leaf in sorted order
+      Leaf* prev;                        // previous leaf in sorted order
+   };
+   struct Inner : Node {
+      ItemType keys[INNER_ORDER];        // keys[i] is the smallest key in
+                                         // the subtree of children[i+1]
+      Node* children[INNER_ORDER + 1];
+   };
+
+   Node* root;                           // root of the tree
+   Leaf* first;                          // leftmost leaf, start of iteration
+   int itemCount;                        // number of items in the tree
+   int levels;                           // number of levels in the tree
+
+   // node allocation
+   Leaf* newLeaf();
+   Inner* newInner();
+
+   // helpers for makeEmpty and copying
+   void makeEmptyHelper(Node*);
+   Node* copyHelper(const Node*, Leaf*&);
+
+   // helper for insert
+   bool insertHelper(Node*, ItemType*, ItemType&, Node*&);
+
+   // helpers for erase
+   bool eraseHelper(Node*, const ItemType&);
+   void fixUnderflow(Inner*, int);
+
+   // finds the leaf that would contain target
+   Leaf* findLeaf(const ItemType&) const;
+
+   // position of the first key in keys[0..count) not less than target
+   static int lowerIndex(const ItemType*, int, const ItemType&);
+
+   // position of the first key in keys[0..count) greater than target
+   static int upperIndex(const ItemType*, int, const ItemType&);
+};
+
+//--------------------------- Default Constructor ----------------------------
+// Preconditions:   None
+// Postconditions:  root is set to nullptr
+template <typename ItemType>
+BPlusTree<ItemType>::BPlusTree() {
+   root = nullptr;
+   first = nullptr;
+   itemCount = 0;
+   levels = 0;
+}
+
+//---------------------------- Destructor ------------------------------------
+// Description:
+// deallocates all memory in *this
+// Postconditions:  *this is deallocated
+template <typename ItemType>
+BPlusTree<ItemType>::~BPlusTree() {
+   makeEmpty();
+}
+
+//------------------------- Copy Constructor ---------------------------------
+// Description:
+// deep copies a BPlusTree into *this
+// Postconditions:  *this is a copy of right
+template <typename ItemType>
+BPlusTree<ItemType>::BPlusTree(const BPlusTree<ItemType>& right) {
+   Leaf* last = nullptr;
+   root = copyHelper(right.root, last);
+   first = nullptr;
+   if(root != nullptr) {
+      // walk back from the last copied leaf to find the first one
+      first = last;
+      while(first->prev != nullptr) {
+         first = first->prev;
+      }
+   }
+   itemCount = right.itemCount;
+   levels = right.levels;
+}
+
+//----------------------------- operator= ------------------------------------
+// Description:
+// deep copies a BPlusTree into *this
+// Postconditions:  *this is a copy of right
+template <typename ItemType>
+BPlusTree<ItemType>& BPlusTree<ItemType>::operator=(
+                                          const BPlusTree<ItemType>& right) {
+   if(&right != this) {
+      BPlusTree<ItemType> temp(right);
+      makeEmpty();
+      swap(root, temp.root);
+      swap(first, temp.first);
+      swap(itemCount, temp.itemCount);
+      swap(levels, temp.levels);
+   }
+   return *this;
+}
+
+//---------------------------- copyHelper ------------------------------------
+// Description:
+// deep copies the subtree at rightCurrent, leaves are linked in the order
+// they are created, which is sorted order
+// Preconditions:   last is the most recently copied leaf, or nullptr
+// Postconditions:  returns the root of the copy, last is the last leaf copied
+template <typename ItemType>
+typename BPlusTree<ItemType>::Node* BPlusTree<ItemType>::copyHelper(
+                                       const Node* rightCurrent, Leaf*& last) {
+   if(rightCurrent == nullptr) {
+      return nullptr;
+   }
+   if(rightCurrent->isLeaf) {
+      const Leaf* rightLeaf = static_cast<const Leaf*>(rightCurrent);
+      Leaf* leaf = newLeaf();
+      leaf->count = rightLeaf->count;
+      copy(rightLeaf->keys, rightLeaf->keys + rightLeaf->count, leaf->keys);
+
+      // link the new leaf after the previous one
+      leaf->prev = last;
+      if(last != nullptr) {
+         last->next = leaf;
+      }
+      last = leaf;
+      return leaf;
+   }
+   const Inner* rightInner = static_cast<const Inner*>(rightCurrent);
+   Inner* inner = newInner();
+   inner->count = rightInner->count;
+   copy(rightInner->keys, rightInner->keys + rightInner->count, inner->keys);
+   for(int i = 0; i <= inner->count; i++) {
+      inner->children[i] = copyHelper(rightInner->children[i], last);
+   }
+   return inner;
+}
+
+//----------------------------- makeEmpty ------------------------------------
+// Description:
+// deallocates all memory in *this
+// Postconditions:  root is null, the count and height are 0
+template <typename ItemType>
+void BPlusTree<ItemType>::makeEmpty() {
+   makeEmptyHelper(root);
+   root = nullptr;
+   first = nullptr;
+   itemCount = 0;
+   levels = 0;
+}
+
+//--------------------------- makeEmptyHelper --------------------------------
+// Description:
+// deallocates current and all nodes below it in a postorder traversal
+template <typename ItemType>
+void BPlusTree<ItemType>::makeEmptyHelper(Node* current) {
+   if(current == nullptr) {
+      return;
+   }
+   if(current->isLeaf) {
+      delete static_cast<Leaf*>(current);
+      return;
+   }
+   Inner* inner = static_cast<Inner*>(current);
+   for(int i = 0; i <= inner->count; i++) {
+      makeEmptyHelper(inner->children[i]);
+   }
+   delete inner;
+}
+
+//----------------------------- newLeaf/newInner -----------------------------
+// Description:
+// allocate an empty node
+template <typename ItemType>
+typename BPlusTree<ItemType>::Leaf* BPlusTree<ItemType>::newLeaf() {
+   Leaf* leaf = new Leaf;
+   leaf->isLeaf = true;
+   leaf->count = 0;
+   leaf->next = leaf->prev = nullptr;
+   return leaf;
+}
+
+template <typename ItemType>
+typename BPlusTree<ItemType>::Inner* BPlusTree<ItemType>::newInner() {
+   Inner* inner = new Inner;
+   inner->isLeaf = false;
+   inner->count = 0;
+   return inner;
+}
+
+//----------------------------- operator== -----------------------------------
+// Description:
+// two trees are equal if they hold the same items, regardless of shape
+// Postconditions:  return true if trees have the same data
+//                  return false otherwise
+template <typename ItemType>
+bool BPlusTree<ItemType>::operator==(const BPlusTree<ItemType>& right) const {
+   if(itemCount != right.itemCount) {
+      return false;
+   }
+   const_iterator mine = begin(), theirs = right.begin();
+   for(; mine != end(); ++mine, ++theirs) {
+      if(!(*mine == *theirs)) {
+         return false;
+      }
+   }
+   return true;
+}
+
+//----------------------------- operator!= -----------------------------------
+template <typename ItemType>
+bool BPlusTree<ItemType>::operator!=(const BPlusTree<ItemType>& right) const {
+   return !(*this == right);
+}
+
+// ------------------------------ isEmpty ------------------------------------
+template <typename ItemType>
+bool BPlusTree<ItemType>::isEmpty() const {
+   return root == nullptr;
+}
+
+//----------------------------- height/getCount ------------------------------
+// both are kept up to date by insert and erase
+template <typename ItemType>
+int BPlusTree<ItemType>::height() const {
+   return levels;
+}
+
+template <typename ItemType>
+int BPlusTree<ItemType>::getCount() const {
+   return itemCount;
+}
+
+//------------------------- lowerIndex/upperIndex ----------------------------
+// Description:
+// binary search within one node
+template <typename ItemType>
+int BPlusTree<ItemType>::lowerIndex(const ItemType* keys, int count,
+                                                   const ItemType& target) {
+   return lower_bound(keys, keys + count, target) - keys;
+}
+
+template <typename ItemType>
+int BPlusTree<ItemType>::upperIndex(const ItemType* keys, int count,
+                                                   const ItemType& target) {
+   return upper_bound(keys, keys + count, target) - keys;
+}
+
+//------------------------------- findLeaf -----------------------------------
+// Description:
+// descends from the root to the leaf whose range covers target
+// Postconditions:  returns nullptr if the tree is empty
+template <typename ItemType>
+typename BPlusTree<ItemType>::Leaf* BPlusTree<ItemType>::findLeaf(
+                                             const ItemType& target) const {
+   Node* current = root;
+   if(current == nullptr) {
+      return nullptr;
+   }
+   while(!current->isLeaf) {
+      Inner* inner = static_cast<Inner*>(current);
+      current = inner->children[upperIndex(inner->keys, inner->count, target)];
+   }
+   return static_cast<Leaf*>(current);
+}
+
+// ------------------------------ insert -------------------------------------
+// Description:
+// moves *newData into the leaf where it belongs, splitting full nodes on the
+// way back up; a split of the root adds a new level
+// Preconditions:   newData has been allocated
+// Postconditions:  newData is deleted if it was inserted; return false and
+//                  leave newData with the caller if it was a duplicate
+template <typename ItemType>
+bool BPlusTree<ItemType>::insert(ItemType* newData) {
+   if(root == nullptr) {
+      Leaf* leaf = newLeaf();
+      leaf->keys[0] = std::move(*newData);
+      leaf->count = 1;
+      root = first = leaf;
+      itemCount = levels = 1;
+      delete newData;
+      return true;
+   }
+
+   ItemType splitKey;
+   Node* sibling = nullptr;
+   if(!insertHelper(root, newData, splitKey, sibling)) {
+      return false;
+   }
+   delete newData;
+
+   // the root was split, grow the tree by one level
+   if(sibling != nullptr) {
+      Inner* newRoot = newInner();
+      newRoot->count = 1;
+      newRoot->keys[0] = std::move(splitKey);
+      newRoot->children[0] = root;
+      newRoot->children[1] = sibling;
+      root = newRoot;
+      levels++;
+   }
+   itemCount++;
+   return true;
+}
+
+//--------------------------- insertHelper -----------------------------------
+// Description:
+// moves *newData into the subtree at current
+// Postconditions:  return false if *newData is a duplicate, it is unchanged
+//                  if current had to split, sibling is the new right half and
+//                  splitKey is the smallest key reachable through it
+//                  otherwise sibling is nullptr
+template <typename ItemType>
+bool BPlusTree<ItemType>::insertHelper(Node* current, ItemType* newData,
+                                       ItemType& splitKey, Node*& sibling) {
+   sibling = nullptr;
+   if(current->isLeaf) {
+      Leaf* leaf = static_cast<Leaf*>(current);
+      int pos = lowerIndex(leaf->keys, leaf->count, *newData);
+      if(pos < leaf->count && leaf->keys[pos] == *newData) {
+         return false;                              // duplicate
+      }
+
+      if(leaf->count == LEAF_ORDER) {
+         // split in half, then insert into whichever half newData belongs to
+         Leaf* right = newLeaf();
+         int half = (LEAF_ORDER + 1) / 2;
+         move(leaf->keys + half, leaf->keys + LEAF_ORDER, right->keys);
+         right->count = LEAF_ORDER - half;
+         leaf->count = half;
+
+         right->next = leaf->next;
+         right->prev = leaf;
+         if(leaf->next != nullptr) {
+            leaf->next->prev = right;
+         }
+         leaf->next = right;
+
+         if(pos > half) {
+            pos -= half;
+            leaf = right;
+         }
+         sibling = right;
+      }
+
+      move_backward(leaf->keys + pos, leaf->keys + leaf->count,
+                                      leaf->keys + leaf->count + 1);
+      leaf->keys[pos] = std::move(*newData);
+      leaf->count++;
+
+      if(sibling != nullptr) {
+         splitKey = static_cast<Leaf*>(sibling)->keys[0];
+      }
+      return true;
+   }
+
+   Inner* inner = static_cast<Inner*>(current);
+   int pos = upperIndex(inner->keys, inner->count, *newData);
+   ItemType childKey;
+   Node* childSibling = nullptr;
+   if(!insertHelper(inner->children[pos], newData, childKey, childSibling)) {
+      return false;
+   }
+   if(childSibling == nullptr) {
+      return true;
+   }
+
+   if(inner->count < INNER_ORDER) {
+      // room for the new separator in this node
+      move_backward(inner->keys + pos, inner->keys + inner->count,
+                                       inner->keys + inner->count + 1);
+      copy_backward(inner->children + pos + 1,
+                    inner->children + inner->count + 1,
+                    inner->children + inner->count + 2);
+      inner->keys[pos] = std::move(childKey);
+      inner->children[pos + 1] = childSibling;
+      inner->count++;
+      return true;
+   }
+
+   // this node is full: lay out all keys and children in order, then keep
+   // the left half, move the right half to a new node and push the middle up
+   ItemType keys[INNER_ORDER + 1];
+   Node* children[INNER_ORDER + 2];
+   move(inner->keys, inner->keys + pos, keys);
+   keys[pos] = std::move(childKey);
+   move(inner->keys + pos, inner->keys + INNER_ORDER, keys + pos + 1);
+   copy(inner->children, inner->children + pos + 1, children);
+   children[pos + 1] = childSibling;
+   copy(inner->children + pos + 1, inner->children + INNER_ORDER + 1,
+                                    children + pos + 2);
+
+   int half = (INNER_ORDER + 1) / 2;
+   Inner* right = newInner();
+   inner->count = half;
+   move(keys, keys + half, inner->keys);
+   copy(children, children + half + 1, inner->children);
+
+   right->count = INNER_ORDER - half;
+   move(keys + half + 1, keys + INNER_ORDER + 1, right->keys);
+   copy(children + half + 1, children + INNER_ORDER + 2, right->children);
+
+   splitKey = std::move(keys[half]);
+   sibling = right;
+   return true;
+}
+
+//------------------------------- retrieve -----------------------------------
+// Description:
+// retrieve an item based on ItemType from the tree
+// Postconditions:  return true if the target was found and p is pointing to
+//                  the item inside its leaf
+//                  return false otherwise
+template <typename ItemType>
+bool BPlusTree<ItemType>::retrieve(const ItemType& target,
+                                                   ItemType*& p) const {
+   Leaf* leaf = findLeaf(target);
+   if(leaf == nullptr) {
+      return false;
+   }
+   int pos = lowerIndex(leaf->keys, leaf->count, target);
+   if(pos < leaf->count && leaf->keys[pos] == target) {
+      p = &leaf->keys[pos];
+      return true;
+   }
+   return false;
+}
+
+//---------------------------------- erase ------------------------------------
+// Description:
+// removes target from its leaf; nodes that fall under half full borrow from
+// or merge with a sibling on the way back up, and a root left with a single
+// child is replaced by that child
+// Postconditions: return true if target was found and erased
+//                 return false otherwise
+template <typename ItemType>
+bool BPlusTree<ItemType>::erase(const ItemType& target) {
+   if(root == nullptr || !eraseHelper(root, target)) {
+      return false;
+   }
+   itemCount--;
+
+   if(root->isLeaf) {
+      if(root->count == 0) {
+         delete static_cast<Leaf*>(root);
+         root = nullptr;
+         first = nullptr;
+         levels = 0;
+      }
+   }
+   else if(root->count == 0) {
+      Inner* oldRoot = static_cast<Inner*>(root);
+      root = oldRoot->children[0];
+      delete oldRoot;
+      levels--;
+   }
+   return true;
+}
+
+//------------------------------- eraseHelper ---------------------------------
+// Description:
+// removes target from the subtree at current
+// Postconditions: children of current are at least half full again,
+//                 current itself may be left under half full
+template <typename ItemType>
+bool BPlusTree<ItemType>::eraseHelper(Node* current, const ItemType& target) {
+   if(current->isLeaf) {
+      Leaf* leaf = static_cast<Leaf*>(current);
+      int pos = lowerIndex(leaf->keys, leaf->count, target);
+      if(pos == leaf->count || !(leaf->keys[pos] == target)) {
+         return false;
+      }
+      move(leaf->keys + pos + 1, leaf->keys + leaf->count, leaf->keys + pos);
+      leaf->count--;
+      return true;
+   }
+
+   Inner* inner = static_cast<Inner*>(current);
+   int pos = upperIndex(inner->keys, inner->count, target);
+   if(!eraseHelper(inner->children[pos], target)) {
+      return false;
+   }
+   Node* child = inner->children[pos];
+   int minimum = child->isLeaf ? LEAF_ORDER / 2 : INNER_ORDER / 2;
+   if(child->count < minimum) {
+      fixUnderflow(inner, pos);
+   }
+   return true;
+}
+
+//------------------------------- fixUnderflow --------------------------------
+// Description:
+// parent->children[pos] is under half full; borrow a key from a sibling that
+// can spare one, otherwise merge it with a sibling
+// Postconditions: every child of parent is at least half full
+template <typename ItemType>
+void BPlusTree<ItemType>::fixUnderflow(Inner* parent, int pos) {
+   Node* child = parent->children[pos];
+   Node* left = (pos > 0) ? parent->children[pos - 1] : nullptr;
+   Node* right = (pos < parent->count) ? parent->children[pos + 1] : nullptr;
+   int minimum = child->isLeaf ? LEAF_ORDER / 2 : INNER_ORDER / 2;
+
+   if(child->isLeaf) {
+      Leaf* leaf = static_cast<Leaf*>(child);
+      if(left != nullptr && left->count > minimum) {
+         // move the largest key of the left sibling to the front
+         Leaf* from = static_cast<Leaf*>(left);
+         move_backward(leaf->keys, leaf->keys + leaf->count,
+                                   leaf->keys + leaf->count + 1);
+         leaf->keys[0] = std::move(from->keys[--from->count]);
+         leaf->count++;
+         parent->keys[pos - 1] = leaf->keys[0];
+      }
+      else if(right != nullptr && right->count > minimum) {
+         // move the smallest key of the right sibling to the end
+         Leaf* from = static_cast<Leaf*>(right);
+         leaf->keys[leaf->count++] = std::move(from->keys[0]);
+         move(from->keys + 1, from->keys + from->count, from->keys);
+         from->count--;
+         parent->keys[pos] = from->keys[0];
+      }
+      else {
+         // merge the pair (into, from) and drop the separator between them
+         int at = (left != nullptr) ? pos - 1 : pos;
+         Leaf* into = static_cast<Leaf*>(parent->children[at]);
+         Leaf* from = static_cast<Leaf*>(parent->children[at + 1]);
+         move(from->keys, from->keys + from->count, into->keys + into->count);
+         into->count += from->count;
+         into->next = from->next;
+         if(from->next != nullptr) {
+            from->next->prev = into;
+         }
+         move(parent->keys + at + 1, parent->keys + parent->count,
+                                     parent->keys + at);
+         copy(parent->children + at + 2, parent->children + parent->count + 1,
+                                         parent->children + at + 1);
+         parent->count--;
+         delete from;
+      }
+      return;
+   }
+
+   Inner* inner = static_cast<Inner*>(child);
+   if(left != nullptr && left->count > minimum) {
+      // rotate right: separator comes down, largest key of left goes up
+      Inner* from = static_cast<Inner*>(left);
+      move_backward(inner->keys, inner->keys + inner->count,
+                                 inner->keys + inner->count + 1);
+      copy_backward(inner->children, inner->children + inner->count + 1,
+                                     inner->children + inner->count + 2);
+      inner->keys[0] = std::move(parent->keys[pos - 1]);
+      inner->children[0] = from->children[from->count];
+      inner->count++;
+      parent->keys[pos - 1] = std::move(from->keys[from->count - 1]);
+      from->count--;
+   }
+   else if(right != nullptr && right->count > minimum) {
+      // rotate left: separator comes down, smallest key of right goes up
+      Inner* from = static_cast<Inner*>(right);
+      inner->keys[inner->count] = std::move(parent->keys[pos]);
+      inner->children[inner->count + 1] = from->children[0];
+      inner->count++;
+      parent->keys[pos] = std::move(from->keys[0]);
+      move(from->keys + 1, from->keys + from->count, from->keys);
+      copy(from->children + 1, from->children + from->count + 1,
+                               from->children);
+      from->count--;
+   }
+   else {
+      // merge the pair (into, from) around the separator between them
+      int at = (left != nullptr) ? pos - 1 : pos;
+      Inner* into = static_cast<Inner*>(parent->children[at]);
+      Inner* from = static_cast<Inner*>(parent->children[at + 1]);
+      into->keys[into->count] = std::move(parent->keys[at]);
+      move(from->keys, from->keys + from->count,
+                       into->keys + into->count + 1);
+      copy(from->children, from->children + from->count + 1,
+                           into->children + into->count + 1);
+      into->count += from->count + 1;
+      move(parent->keys + at + 1, parent->keys + parent->count,
+                                  parent->keys + at);
+      copy(parent->children + at + 2, parent->children + parent->count + 1,
+                                      parent->children + at + 1);
+      parent->count--;
+      delete from;
+   }
+}
+
+//--------------------------- begin/end/lowerBound ---------------------------
+// Description:
+// iterators walk the linked leaves in sorted order; end is past the last
+// item of the last leaf
+template <typename ItemType>
+typename BPlusTree<ItemType>::const_iterator
+BPlusTree<ItemType>::begin() const {
+   return const_iterator(first, 0);
+}
+
+template <typename ItemType>
+typename BPlusTree<ItemType>::const_iterator
+BPlusTree<ItemType>::end() const {
+   return const_iterator(nullptr, 0);
+}
+
+template <typename ItemType>
+typename BPlusTree<ItemType>::const_iterator
+BPlusTree<ItemType>::lowerBound(const ItemType& target) const {
+   Leaf* leaf = findLeaf(target);
+   if(leaf == nullptr) {
+      return end();
+   }
+   int pos = lowerIndex(leaf->keys, leaf->count, target);
+   if(pos == leaf->count) {
+      // every key in this leaf is smaller, answer is the next leaf's first
+      return const_iterator(leaf->next, 0);
+   }
+   return const_iterator(leaf, pos);
+}
+
+#endif
@@ -0,0 +1,471 @@
+// --------------------------- ConcurrentBinTree.h ----------------------------
+
+// CSS 343
+// Created: October 19th, 2026
+// Last Modified: October 19th, 2026
+
+// ---------------------------------------------------------------------------
+
+// ConcurrentBinTree class: A binary search tree for many reader threads and
+//                   one writer at a time.
+//                   - Nodes are never changed once they are reachable. An
+//                     insert or erase copies the nodes on the path from the
+//                     root to the change (path copying) and then publishes
+//                     the new root with one atomic store.
+//                   - Readers load the root and search an immutable version
+//                     of the tree, so they never take a lock and never wait
+//                     for the writer.
+//                   - Nodes replaced by a write are freed only after every
+//                     reader that could still be looking at them is done
+//                     (deferred reclamation, see synchronize).
+
+// ---------------------------------------------------------------------------
+
+// Notes on specifications, special algorithms, and assumptions.
+
+//   -- insert, erase and makeEmpty are serialized by a mutex that readers
+//      never touch; the writer waits for old readers after each update
+//   -- readers register in one of two counters picked by the low bit of the
+//      epoch; the writer flips the epoch after publishing a root and waits
+//      for the old counter to drain before freeing the replaced nodes
+//   -- retrieve copies the item out, because an erased item is freed once
+//      no reader can see it any more; forEachInRange calls fn while the
+//      reader is registered, so references passed to fn are safe inside fn
+//   -- the tree takes ownership of inserted ItemType* like BinTree does; a
+//      duplicate is not inserted and stays with the caller
+//   -- operations are O(height); the tree is not rebalanced
+
+// ---------------------------------------------------------------------------
+
+#ifndef CONCURRENTBINTREE_H
+#define CONCURRENTBINTREE_H
+#include <iostream>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <thread>
+using namespace std;
+
+template <typename ItemType>
+class ConcurrentBinTree {
+public:
+   ConcurrentBinTree();                 // constructor
+   ~ConcurrentBinTree();                // destructor, calls makeEmpty
+   ConcurrentBinTree(const ConcurrentBinTree &) = delete;
+   ConcurrentBinTree& operator=(const ConcurrentBinTree &) = delete;
+
+   // ---------- writer side, one writer at a time ----------
+
+   // true if a node is inserted, false for a duplicate, which the caller
+   // still owns
+   bool insert(ItemType*);
+
+   // remove a node based on ItemType from the tree
+   bool erase(const ItemType &);
+
+   // make the tree empty so isEmpty returns true
+   void makeEmpty();
+
+   // ---------- reader side, never blocks ----------
+
+   // copy the item equal to target into found
+   bool retrieve(const ItemType &, ItemType &) const;
+
+   // true if an item equal to target is in the tree
+   bool contains(const ItemType &) const;
+
+   // call fn on every item with lo <= item <= hi, in sorted order
+   template <typename Function>
+   void forEachInRange(const ItemType &, const ItemType &, Function) const;
+
+   // true if tree is empty, otherwise false
+   bool isEmpty() const;
+
+   // get the total number of nodes in the tree
+   int getCount() const;
+
+private:
+   struct Node {
+      const ItemType* data;            // shared by all copies of the node
+      const Node* left;                // left subtree pointer
+      const Node* right;               // right subtree pointer
+      int count;                       // number of nodes in this subtree
+   };
+
+   atomic<const Node*> root;           // current version of the tree
+   mutex writeLock;                    // serializes writers
+
+   mutable atomic<unsigned> epoch;     // flipped once per update
+   mutable atomic<int> readers[2];     // active readers for each epoch bit
+
+   // registers a reader for the lifetime of the guard
+   class ReadGuard {
+   public:
+      explicit ReadGuard(const ConcurrentBinTree&);
+      ~ReadGuard();
+   private:
+      const ConcurrentBinTree& tree;
+      int slot;                        // which readers counter was used
+   };
+
+   // create a node that copies current but has new children
+   static const Node* copyNode(const Node*, const Node*, const Node*);
+   static int subtreeCount(const Node*);
+
+   // path copying helpers, replaced collects the nodes that were copied
+   const Node* insertHelper(const Node*, ItemType*, bool&,
+                            vector<const Node*>&);
+   const Node* eraseHelper(const Node*, const ItemType&, bool&,
+                           vector<const Node*>&, const ItemType*&);
+   const Node* removeSmallest(const Node*, const Node*&,
+                              vector<const Node*>&);
+
+   // publish a new root, wait for old readers, then free what was replaced
+   void publish(const Node*, vector<const Node*>&, const ItemType*);
+   void synchronize();
+
+   // helpers for reading and teardown
+   template <typename Function>
+   void rangeHelper(const ItemType&, const ItemType&, Function&,
+                    const Node*) const;
+   void makeEmptyHelper(const Node*);
+};
+
+//----------------------- Default Constructor --------------------------------
+// Postconditions:  root is set to nullptr
+template <typename ItemType>
+ConcurrentBinTree<ItemType>::ConcurrentBinTree() {
+   root.store(nullptr);
+   epoch.store(0);
+   readers[0].store(0);
+   readers[1].store(0);
+}
+
+//---------------------------- Destructor ------------------------------------
+// Preconditions:   no reader is still using the tree
+template <typename ItemType>
+ConcurrentBinTree<ItemType>::~ConcurrentBinTree() {
+   makeEmpty();
+}
+
+//------------------------------ ReadGuard -----------------------------------
+// Description:
+// a reader adds itself to the counter for the current epoch, then checks
+// the epoch did not move; if it did, the writer may already be waiting on
+// the other counter, so the reader tries again with the new epoch
+template <typename ItemType>
+ConcurrentBinTree<ItemType>::ReadGuard::ReadGuard(
+                     const ConcurrentBinTree<ItemType>& t) : tree(t) {
+   for(;;) {
+      unsigned current = tree.epoch.load();
+      slot = current & 1;
+      tree.readers[slot].fetch_add(1);
+      if(tree.epoch.load() == current) {
+         return;
+      }
+      tree.readers[slot].fetch_sub(1);
+   }
+}
+
+template <typename ItemType>
+ConcurrentBinTree<ItemType>::ReadGuard::~ReadGuard() {
+   tree.readers[slot].fetch_sub(1);
+}
+
+//------------------------------- synchronize --------------------------------
+// Description:
+// waits until every reader that might hold a pointer into a version older
+// than the one just published has finished; readers that arrive after the
+// flip see the new root
+// Preconditions:   the caller holds writeLock and has published a new root
+template <typename ItemType>
+void ConcurrentBinTree<ItemType>::synchronize() {
+   unsigned old = epoch.load();
+   epoch.store(old + 1);
+   while(readers[old & 1].load() != 0) {
+      this_thread::yield();
+   }
+}
+
+//--------------------------------- publish ----------------------------------
+// Description:
+// makes newRoot the current version, then frees the replaced nodes and the
+// erased item once no reader can reach them
+// Preconditions:   the caller holds writeLock
+template <typename ItemType>
+void ConcurrentBinTree<ItemType>::publish(const Node* newRoot,
+                                          vector<const Node*>& replaced,
+                                          const ItemType* erasedData) {
+   root.store(newRoot);
+   synchronize();
+   for(size_t i = 0; i < replaced.size(); i++) {
+      delete replaced[i];              // data lives on in the copies
+   }
+   delete erasedData;
+}
+
+//------------------------------- copyNode -----------------------------------
+// Description:
+// a copy of current with different children, the data is shared
+template <typename ItemType>
+const typename ConcurrentBinTree<ItemType>::Node*
+ConcurrentBinTree<ItemType>::copyNode(const Node* current, const Node* left,
+                                      const Node* right) {
+   Node* copy = new Node;
+   copy->data = current->data;
+   copy->left = left;
+   copy->right = right;
+   copy->count = subtreeCount(left) + subtreeCount(right) + 1;
+   return copy;
+}
+
+template <typename ItemType>
+int ConcurrentBinTree<ItemType>::subtreeCount(const Node* current) {
+   return (current == nullptr) ? 0 : current->count;
+}
+
+// ------------------------------ insert -------------------------------------
+// Description:
+// builds a new version of the tree that contains newData and publishes it
+// Preconditions:   ItemType newData has been allocated
+// Postconditions:  return true if inserted, a duplicate is left with the
+//                  caller
+template <typename ItemType>
+bool ConcurrentBinTree<ItemType>::insert(ItemType* newData) {
+   lock_guard<mutex> lock(writeLock);
+   bool inserted = false;
+   vector<const Node*> replaced;
+   const Node* newRoot = insertHelper(root.load(), newData, inserted,
+                                                            replaced);
+   if(!inserted) {
+      return false;
+   }
+   publish(newRoot, replaced, nullptr);
+   return true;
+}
+
+//--------------------------- insertHelper -----------------------------------
+// Description:
+// returns the root of a copy of the subtree with newData added; nodes off
+// the search path are shared with the old version
+// Postconditions:  inserted is false and current is returned for a duplicate
+template <typename ItemType>
+const typename ConcurrentBinTree<ItemType>::Node*
+ConcurrentBinTree<ItemType>::insertHelper(const Node* current,
+                     ItemType* newData, bool& inserted,
+                     vector<const Node*>& replaced) {
+   if(current == nullptr) {
+      Node* leaf = new Node;
+      leaf->data = newData;
+      leaf->left = leaf->right = nullptr;
+      leaf->count = 1;
+      inserted = true;
+      return leaf;
+   }
+   if(*newData < *current->data) {
+      const Node* left = insertHelper(current->left, newData, inserted,
+                                                             replaced);
+      if(!inserted) {
+         return current;
+      }
+      replaced.push_back(current);
+      return copyNode(current, left, current->right);
+   }
+   if(*current->data < *newData) {
+      const Node* right = insertHelper(current->right, newData, inserted,
+                                                               replaced);
+      if(!inserted) {
+         return current;
+      }
+      replaced.push_back(current);
+      return copyNode(current, current->left, right);
+   }
+   return current;                     // duplicate
+}
+
+//---------------------------------- erase ------------------------------------
+// Description:
+// builds a new version of the tree without target and publishes it
+// Postconditions: return true if target was found and erased
+template <typename ItemType>
+bool ConcurrentBinTree<ItemType>::erase(const ItemType& target) {
+   lock_guard<mutex> lock(writeLock);
+   bool erased = false;
+   vector<const Node*> replaced;
+   const ItemType* erasedData = nullptr;
+   const Node* newRoot = eraseHelper(root.load(), target, erased, replaced,
+                                                               erasedData);
+   if(!erased) {
+      return false;
+   }
+   publish(newRoot, replaced, erasedData);
+   return true;
+}
+
+//------------------------------- eraseHelper ---------------------------------
+// Description:
+// returns the root of a copy of the subtree without target; a node with two
+// children is replaced by a copy holding the smallest item of its right
+// subtree
+// Postconditions: erasedData is the item that was removed
+template <typename ItemType>
+const typename ConcurrentBinTree<ItemType>::Node*
+ConcurrentBinTree<ItemType>::eraseHelper(const Node* current,
+                     const ItemType& target, bool& erased,
+                     vector<const Node*>& replaced,
+                     const ItemType*& erasedData) {
+   if(current == nullptr) {
+      return nullptr;
+   }
+   if(target < *current->data) {
+      const Node* left = eraseHelper(current->left, target, erased,
+                                     replaced, erasedData);
+      if(!erased) {
+         return current;
+      }
+      replaced.push_back(current);
+      return copyNode(current, left, current->right);
+   }
+   if(*current->data < target) {
+      const Node* right = eraseHelper(current->right, target, erased,
+                                      replaced, erasedData);
+      if(!erased) {
+         return current;
+      }
+      replaced.push_back(current);
+      return copyNode(current, current->left, right);
+   }
+
+   erased = true;
+   erasedData = current->data;
+   replaced.push_back(current);
+   if(current->left == nullptr) {
+      return current->right;
+   }
+   if(current->right == nullptr) {
+      return current->left;
+   }
+   const Node* smallest = nullptr;
+   const Node* right = removeSmallest(current->right, smallest, replaced);
+   return copyNode(smallest, current->left, right);
+}
+
+//----------------------------- removeSmallest --------------------------------
+// Description:
+// returns a copy of the subtree without its smallest node
+// Postconditions: smallest is the node that was removed
+template <typename ItemType>
+const typename ConcurrentBinTree<ItemType>::Node*
+ConcurrentBinTree<ItemType>::removeSmallest(const Node* current,
+                     const Node*& smallest, vector<const Node*>& replaced) {
+   replaced.push_back(current);
+   if(current->left == nullptr) {
+      smallest = current;
+      return current->right;
+   }
+   const Node* left = removeSmallest(current->left, smallest, replaced);
+   return copyNode(current, left, current->right);
+}
+
+//----------------------------- makeEmpty ------------------------------------
+// Description:
+// publishes an empty tree, then frees the old version and all its data
+template <typename ItemType>
+void ConcurrentBinTree<ItemType>::makeEmpty() {
+   lock_guard<mutex> lock(writeLock);
+   const Node* old = root.load();
+   root.store(nullptr);
+   synchronize();
+   makeEmptyHelper(old);
+}
+
+template <typename ItemType>
+void ConcurrentBinTree<ItemType>::makeEmptyHelper(const Node* current) {
+   if(current == nullptr) {
+      return;
+   }
+   makeEmptyHelper(current->left);
+   makeEmptyHelper(current->right);
+   delete current->data;
+   delete current;
+}
+
+//------------------------------- retrieve -----------------------------------
+// Postconditions:  return true and found is a copy of the item if target is
+//                  in the tree, return false otherwise
+template <typename ItemType>
+bool ConcurrentBinTree<ItemType>::retrieve(const ItemType& target,
+                                           ItemType& found) const {
+   ReadGuard guard(*this);
+   const Node* current = root.load();
+   while(current != nullptr) {
+      if(*current->data == target) {
+         found = *current->data;
+         return true;
+      }
+      current = (*current->data < target) ? current->right : current->left;
+   }
+   return false;
+}
+
+//------------------------------- contains -----------------------------------
+template <typename ItemType>
+bool ConcurrentBinTree<ItemType>::contains(const ItemType& target) const {
+   ReadGuard guard(*this);
+   const Node* current = root.load();
+   while(current != nullptr) {
+      if(*current->data == target) {
+         return true;
+      }
+      current = (*current->data < target) ? current->right : current->left;
+   }
+   return false;
+}
+
+//----------------------------- forEachInRange -------------------------------
+// Description:
+// calls fn(const ItemType&) on each item between lo and hi (inclusive) in
+// sorted order, all from the same version of the tree
+template <typename ItemType>
+template <typename Function>
+void ConcurrentBinTree<ItemType>::forEachInRange(const ItemType& lo,
+                                    const ItemType& hi, Function fn) const {
+   ReadGuard guard(*this);
+   rangeHelper(lo, hi, fn, root.load());
+}
+
+template <typename ItemType>
+template <typename Function>
+void ConcurrentBinTree<ItemType>::rangeHelper(const ItemType& lo,
+                                    const ItemType& hi, Function& fn,
+                                    const Node* current) const {
+   if(current == nullptr) {
+      return;
+   }
+   bool aboveLo = *current->data >= lo;
+   bool belowHi = *current->data <= hi;
+   if(aboveLo) {
+      rangeHelper(lo, hi, fn, current->left);
+   }
+   if(aboveLo && belowHi) {
+      fn(*current->data);
+   }
+   if(belowHi) {
+      rangeHelper(lo, hi, fn, current->right);
+   }
+}
+
+// ------------------------------ isEmpty ------------------------------------
+template <typename ItemType>
+bool ConcurrentBinTree<ItemType>::isEmpty() const {
+   return root.load() == nullptr;
+}
+
+//------------------------------- getCount ------------------------------------
+template <typename ItemType>
+int ConcurrentBinTree<ItemType>::getCount() const {
+   ReadGuard guard(*this);
+   return subtreeCount(root.load());
+}
+
+#endif
@@ -1,13 +1,36 @@
 #include "bintree.h"
+#include "bplustree.h"
+#include "intrusivebintree.h"
+#include "concurrentbintree.h"
+#include "persistentbintree.h"
+#include "radixtree.h"
 #include <fstream>
 #include <iostream>
 using namespace std;
 
 const int ARRAYSIZE = 100;
 
+// NodeData that carries its own tree links, for IntrusiveBinTree
+class Word : public NodeData, public BinTreeHook<Word> {
+public:
+   Word(const string& s) : NodeData(s) {}
+};
+
 //global function prototypes
 void buildTree(BinTree<NodeData>&, ifstream&);     
 void initArray(NodeData*[]);                      // initialize array to NULL
+void readWords(ifstream&, vector<string>&);       // one line of data
+void testBPlusTree(const vector<string>&);
+void testNodeAllocation(const vector<string>&);
+void testConcurrentBinTree();
+void testPersistentBinTree(const vector<string>&);
+void testSetAlgebra(const vector<string>&);
+void testLargeTree();
+void testRadixTree(const vector<string>&);
+void testConversions(const vector<string>&);
+void testRangeQueries(const vector<string>&);
+void testOrderStatistics(const vector<string>&);
+void testDigest(const vector<string>&);
 
 int main() {
    // create file object infile and open it
@@ -109,6 +132,22 @@ int main() {
       cout << endl;
    }
 
+   // the other ordered indexes, built from the first line of data
+   ifstream wordfile("inputdata.txt");
+   vector<string> words;
+   readWords(wordfile, words);
+   testBPlusTree(words);
+   testNodeAllocation(words);
+   testConcurrentBinTree();
+   testPersistentBinTree(words);
+   testSetAlgebra(words);
+   testLargeTree();
+   testRadixTree(words);
+   testConversions(words);
+   testRangeQueries(words);
+   testOrderStatistics(words);
+   testDigest(words);
+
    return 0;
 }
 
@@ -149,4 +188,544 @@ void initArray(NodeData* ndArray[]) {
       ndArray[i] = NULL;
 }
 
+//------------------------------- readWords ----------------------------------
+// Description:
+// reads the strings of one line of data, up to "$$", into words
+// Preconditions:    infile is open
+// Postconditions:   words holds the strings of the line in file order
+
+void readWords(ifstream& infile, vector<string>& words) {
+   string s;
+   while (infile >> s && s != "$$") {
+      words.push_back(s);
+   }
+}
+
+//----------------------------- testBPlusTree --------------------------------
+// Description:
+// builds a BPlusTree from words and tests retrieve, erase, lowerBound,
+// the copy constructor and ==
+// Preconditions:    none
+// Postconditions:   results are displayed
+
+void testBPlusTree(const vector<string>& words) {
+   cout << "---------------------------------------------------------------"
+        << endl;
+   cout << "BPlusTree:" << endl;
+   BPlusTree<NodeData> B;
+   for (const string& w : words) {
+      NodeData* ptr = new NodeData(w);
+      if (!B.insert(ptr)) delete ptr;      // duplicate stays with the caller
+   }
+   cout << "Inorder: " << B;
+   cout << "Count: " << B.getCount() << "   Height: " << B.height() << endl;
+
+   NodeData* p;
+   bool found = B.retrieve(NodeData("and"), p);
+   cout << "Retrieve --> and:  " << (found ? "found" : "not found") << endl;
+   found = B.retrieve(NodeData("b"), p);
+   cout << "Retrieve --> b:    " << (found ? "found" : "not found") << endl;
+
+   BPlusTree<NodeData> copy(B);
+   B.erase(NodeData("not"));
+   B.erase(NodeData("eee"));
+   cout << "After erasing not and eee: " << B;
+   cout << "B == copy?   " << (B == copy ? "equal" : "not equal") << endl;
+
+   cout << "From m on: ";
+   for (BPlusTree<NodeData>::const_iterator it =
+           copy.lowerBound(NodeData("m")); it != copy.end(); ++it) {
+      cout << *it << " ";
+   }
+   cout << endl;
+}
+
+//--------------------------- testNodeAllocation -----------------------------
+// Description:
+// builds the same tree with nodes from a NodePool and from the heap, and an
+// IntrusiveBinTree whose links live in the items
+// Preconditions:    none
+// Postconditions:   results are displayed, every item is freed
+
+void testNodeAllocation(const vector<string>& words) {
+   cout << "---------------------------------------------------------------"
+        << endl;
+   cout << "Node allocation:" << endl;
+   BinTree<NodeData> pooled;                    // NodePool is the default
+   BinTree<NodeData, NodeHeap> heap;
+   for (const string& w : words) {
+      NodeData* ptr = new NodeData(w);
+      if (!pooled.insert(ptr)) delete ptr;
+      ptr = new NodeData(w);
+      if (!heap.insert(ptr)) delete ptr;
+   }
+   cout << "NodePool tree: " << pooled;
+   cout << "NodeHeap tree: " << heap;
+   cout << "Counts: " << pooled.getCount() << " " << heap.getCount() << endl;
+   pooled.makeEmpty();                          // frees the blocks at once
+   cout << "NodePool tree after makeEmpty is "
+        << (pooled.isEmpty() ? "empty" : "not empty") << endl;
+
+   IntrusiveBinTree<Word> links;
+   vector<Word*> items;                         // the tree does not own them
+   for (const string& w : words) {
+      Word* item = new Word(w);
+      items.push_back(item);
+      links.insert(item);                       // duplicates stay unlinked
+   }
+   cout << "IntrusiveBinTree: " << links;
+   cout << "Count: " << links.getCount() << "   Height: " << links.height()
+        << endl;
+   Word* p;
+   bool found = links.erase(Word("not"), p);
+   cout << "Erase --> not:  " << (found ? "found" : "not found") << endl;
+   found = links.retrieve(Word("not"), p);
+   cout << "Retrieve --> not:  " << (found ? "found" : "not found") << endl;
+   links.makeEmpty();
+   for (Word* item : items) {
+      delete item;
+   }
+}
+
+//------------------------- testConcurrentBinTree ----------------------------
+// Description:
+// one writer thread inserts KEYS strings and then erases every other one,
+// while reader threads look keys up and walk ranges; afterwards the
+// contents are checked against what the writer did
+// Preconditions:    none
+// Postconditions:   results are displayed
+
+void testConcurrentBinTree() {
+   const int KEYS = 2000, READERS = 3;
+   cout << "---------------------------------------------------------------"
+        << endl;
+   cout << "ConcurrentBinTree:" << endl;
+   ConcurrentBinTree<NodeData> C;
+   atomic<bool> writing(true);
+   atomic<bool> ordered(true);                  // readers saw sorted ranges
+
+   // 7919 is prime, so the keys go in scrambled and the tree stays shallow
+   thread writer([&]() {
+      for (int i = 0; i < KEYS; i++) {
+         C.insert(new NodeData(to_string(i * 7919 % KEYS)));
+      }
+      for (int i = 1; i < KEYS; i += 2) {
+         C.erase(NodeData(to_string(i)));
+      }
+      writing = false;
+   });
+   vector<thread> readers;
+   for (int r = 0; r < READERS; r++) {
+      readers.push_back(thread([&, r]() {
+         NodeData found;
+         int i = r;
+         while (writing) {
+            C.retrieve(NodeData(to_string(i % KEYS)), found);
+            string previous;
+            C.forEachInRange(NodeData("1"), NodeData("2"),
+                             [&](const NodeData& item) {
+               if (item.key() < previous) ordered = false;
+               previous = item.key();
+            });
+            i += READERS;
+         }
+      }));
+   }
+   writer.join();
+   for (thread& t : readers) {
+      t.join();
+   }
+
+   NodeData* duplicate = new NodeData("0");
+   if (!C.insert(duplicate)) delete duplicate;
+
+   bool contentsMatch = C.getCount() == KEYS / 2;
+   for (int i = 0; i < KEYS; i++) {
+      contentsMatch = contentsMatch &&
+                      C.contains(NodeData(to_string(i))) == (i % 2 == 0);
+   }
+   cout << "Count: " << C.getCount() << endl;
+   cout << "Readers saw sorted ranges:  " << (ordered ? "yes" : "no") << endl;
+   cout << "Contents match the writer:  " << (contentsMatch ? "yes" : "no")
+        << endl;
+}
+
+//------------------------- testPersistentBinTree ----------------------------
+// Description:
+// takes a snapshot of a PersistentBinTree, changes the tree and shows that
+// the snapshot still holds the old version
+// Preconditions:    none
+// Postconditions:   results are displayed
+
+void testPersistentBinTree(const vector<string>& words) {
+   cout << "---------------------------------------------------------------"
+        << endl;
+   cout << "PersistentBinTree:" << endl;
+   PersistentBinTree<NodeData> P;
+   for (const string& w : words) {
+      NodeData* ptr = new NodeData(w);
+      if (!P.insert(ptr)) delete ptr;      // duplicate stays with the caller
+   }
+   PersistentBinTree<NodeData> before = P.snapshot();
+   cout << "P == snapshot?  " << (P == before ? "equal" : "not equal")
+        << endl;
+
+   P.erase(NodeData("not"));
+   P.erase(NodeData("and"));
+   P.insert(new NodeData("b"));
+   cout << "P after erasing not and and, inserting b:" << endl << "  " << P;
+   cout << "Snapshot taken before:" << endl << "  " << before;
+   cout << "Counts: " << P.getCount() << " " << before.getCount() << endl;
+   cout << "P == snapshot?  " << (P == before ? "equal" : "not equal")
+        << endl;
+
+   const NodeData* p;
+   bool found = before.retrieve(NodeData("not"), p);
+   cout << "Snapshot retrieve --> not:  " << (found ? "found" : "not found")
+        << endl;
+   P.makeEmpty();
+   cout << "After P.makeEmpty, snapshot count: " << before.getCount() << endl;
+}
+
+//----------------------------- testSetAlgebra -------------------------------
+// Description:
+// unionWith, intersectWith and difference of a tree built from words and
+// a small second tree; the difference and intersection together must give
+// back the first tree
+// Preconditions:    none
+// Postconditions:   results are displayed
+
+void testSetAlgebra(const vector<string>& words) {
+   cout << "---------------------------------------------------------------"
+        << endl;
+   cout << "Set algebra:" << endl;
+   BinTree<NodeData> A, B;
+   for (const string& w : words) {
+      NodeData* ptr = new NodeData(w);
+      if (!A.insert(ptr)) delete ptr;
+   }
+   const string others[] = { "a", "b", "eee", "not", "r", "zz" };
+   for (const string& w : others) {
+      B.insert(new NodeData(w));
+   }
+   cout << "A: " << A;
+   cout << "B: " << B;
+
+   BinTree<NodeData> unionAB(A), moved(B);
+   unionAB.unionWith(moved);                    // moved is left empty
+   cout << "A union B:        " << unionAB;
+   cout << "moved is " << (moved.isEmpty() ? "empty" : "not empty") << endl;
+
+   BinTree<NodeData> intersection(A), difference(A);
+   intersection.intersectWith(B);
+   difference.difference(B);
+   cout << "A intersect B:    " << intersection;
+   cout << "A difference B:   " << difference;
+   cout << "Counts: " << unionAB.getCount() << " " << intersection.getCount()
+        << " " << difference.getCount() << endl;
+
+   difference.unionWith(intersection);
+   cout << "(A - B) union (A intersect B) == A?  "
+        << (difference == A ? "equal" : "not equal") << endl;
+}
+
+//------------------------------ testLargeTree -------------------------------
+// Description:
+// a tree big enough that copying, emptying and parallelReduce fork into
+// tasks; the copy must equal the original and the parallel fold must
+// match a plain walk
+// Preconditions:    none
+// Postconditions:   results are displayed
+
+void testLargeTree() {
+   const int ITEMS = 50000;
+   cout << "---------------------------------------------------------------"
+        << endl;
+   cout << "Large tree (" << ITEMS << " items):" << endl;
+   vector<NodeData*> sorted;
+   for (int i = 0; i < ITEMS; i++) {
+      string key = to_string(i);
+      sorted.push_back(new NodeData(string(5 - key.size(), '0') + key));
+   }
+   BinTree<NodeData> big;
+   big.buildFromSorted(sorted);
+
+   BinTree<NodeData> copy(big);
+   cout << "Count: " << copy.getCount() << "   Height: " << copy.height()
+        << endl;
+   cout << "copy == big?  " << (copy == big ? "equal" : "not equal") << endl;
 
+   // total length of all keys, folded in parallel and by a plain walk
+   long long parallel = copy.parallelReduce(0LL,
+      [](const NodeData& item) { return (long long)item.key().size(); },
+      [](long long a, long long b) { return a + b; });
+   long long plain = 0;
+   for (const NodeData& item : copy) {
+      plain += item.key().size();
+   }
+   cout << "parallelReduce == plain walk?  "
+        << (parallel == plain ? "equal" : "not equal") << endl;
+
+   copy.makeEmpty();
+   cout << "copy after makeEmpty is "
+        << (copy.isEmpty() ? "empty" : "not empty") << ", big still has "
+        << big.getCount() << endl;
+}
+
+//------------------------------ testRadixTree -------------------------------
+// Description:
+// builds a RadixTree from words plus keys that share prefixes, and tests
+// retrieve, prefix search, erase and the copy constructor
+// Preconditions:    none
+// Postconditions:   results are displayed
+
+void testRadixTree(const vector<string>& words) {
+   cout << "---------------------------------------------------------------"
+        << endl;
+   cout << "RadixTree:" << endl;
+   RadixTree<NodeData> R;
+   vector<string> keys(words);
+   const string more[] = { "te", "tea", "team", "ten", "tttt", "t" };
+   keys.insert(keys.end(), more, more + 6);
+   for (const string& k : keys) {
+      NodeData* ptr = new NodeData(k);
+      if (!R.insert(ptr)) delete ptr;           // duplicate key
+   }
+   cout << "Inorder: " << R;
+   cout << "Count: " << R.getCount() << endl;
+
+   NodeData* p;
+   bool found = R.retrieve(NodeData("tea"), p);
+   cout << "Retrieve --> tea:  " << (found ? "found" : "not found") << endl;
+   found = R.retrieve(NodeData("teas"), p);
+   cout << "Retrieve --> teas: " << (found ? "found" : "not found") << endl;
+
+   cout << "Prefix te: ";
+   R.forEachWithPrefix("te", [](const NodeData& item) {
+      cout << item << " ";
+   });
+   cout << endl;
+
+   RadixTree<NodeData> copy(R);
+   R.erase(NodeData("te"));
+   R.erase(NodeData("team"));
+   cout << "Prefix te after erasing te and team: ";
+   R.forEachWithPrefix("te", [](const NodeData& item) {
+      cout << item << " ";
+   });
+   cout << endl;
+   cout << "Copy count: " << copy.getCount() << "   Count: " << R.getCount()
+        << endl;
+}
+
+//---------------------------- testConversions ------------------------------
+// Description:
+// arrayToBSTree into a tree that already has data and from an unsorted
+// array, and a round trip through toSortedVector, extract and
+// buildFromSorted
+// Preconditions:    none
+// Postconditions:   results are displayed, every item is freed
+
+void testConversions(const vector<string>& words) {
+   cout << "---------------------------------------------------------------"
+        << endl;
+   cout << "Conversions:" << endl;
+   NodeData* ndArray[ARRAYSIZE];
+
+   // and and m are already in the tree, the array copies are deleted
+   BinTree<NodeData> T;
+   T.insert(new NodeData("and"));
+   T.insert(new NodeData("m"));
+   initArray(ndArray);
+   const string sortedKeys[] = { "and", "b", "m", "z" };
+   for (int i = 0; i < 4; i++) {
+      ndArray[i] = new NodeData(sortedKeys[i]);
+   }
+   T.arrayToBSTree(ndArray);
+   cout << "arrayToBSTree into a tree with and, m:  " << T;
+   cout << "Count: " << T.getCount() << "   array emptied?  "
+        << (ndArray[0] == nullptr && ndArray[3] == nullptr ? "yes" : "no")
+        << endl;
+
+   // out of order data is inserted, not linked as it stands
+   BinTree<NodeData> U;
+   initArray(ndArray);
+   const string unsortedKeys[] = { "y", "c", "q", "c", "a" };
+   for (int i = 0; i < 5; i++) {
+      ndArray[i] = new NodeData(unsortedKeys[i]);
+   }
+   U.arrayToBSTree(ndArray);
+   cout << "arrayToBSTree from y c q c a:  " << U;
+
+   // round trip
+   BinTree<NodeData> W, original;
+   for (const string& w : words) {
+      NodeData* ptr = new NodeData(w);
+      if (!W.insert(ptr)) delete ptr;
+   }
+   original = W;
+   vector<const NodeData*> view = W.toSortedVector();
+   bool ordered = (int)view.size() == W.getCount();
+   for (size_t i = 1; i < view.size(); i++) {
+      ordered = ordered && *view[i - 1] < *view[i];
+   }
+   cout << "toSortedVector sorted with every item?  "
+        << (ordered ? "yes" : "no") << endl;
+   vector<NodeData*> owned = W.extract();
+   bool samePointers = owned.size() == view.size() &&
+                       equal(owned.begin(), owned.end(), view.begin());
+   cout << "extract gave the same items?  " << (samePointers ? "yes" : "no")
+        << ", tree is " << (W.isEmpty() ? "empty" : "not empty") << endl;
+   W.buildFromSorted(owned);
+   cout << "rebuilt == original?  " << (W == original ? "equal" : "not equal")
+        << endl;
+}
+
+//---------------------------- testRangeQueries -----------------------------
+// Description:
+// lowerBound, upperBound, equalRange and forEachInRange with targets below
+// the smallest item, above the largest, on an item and between items, and
+// a walk backwards from end with --
+// Preconditions:    none
+// Postconditions:   results are displayed
+
+void testRangeQueries(const vector<string>& words) {
+   cout << "---------------------------------------------------------------"
+        << endl;
+   cout << "Range queries:" << endl;
+   BinTree<NodeData> T;
+   for (const string& w : words) {
+      NodeData* ptr = new NodeData(w);
+      if (!T.insert(ptr)) delete ptr;
+   }
+   cout << "Inorder: " << T;
+
+   const string targets[] = { "", "and", "n", "z", "zz" };
+   for (const string& target : targets) {
+      NodeData key(target);
+      BinTree<NodeData>::const_iterator lower = T.lowerBound(key);
+      BinTree<NodeData>::const_iterator upper = T.upperBound(key);
+      pair<BinTree<NodeData>::const_iterator,
+           BinTree<NodeData>::const_iterator> range = T.equalRange(key);
+      cout << "\"" << target << "\":  lowerBound "
+           << (lower == T.end() ? "end" : lower->key())
+           << ", upperBound " << (upper == T.end() ? "end" : upper->key())
+           << ", equalRange has "
+           << distance(range.first, range.second) << endl;
+   }
+
+   cout << "forEachInRange b..p: ";
+   T.forEachInRange(NodeData("b"), NodeData("p"),
+                    [](const NodeData& item) { cout << item << " "; });
+   cout << endl << "forEachInRange and..m: ";
+   T.forEachInRange(NodeData("and"), NodeData("m"),
+                    [](const NodeData& item) { cout << item << " "; });
+   cout << endl << "forEachInRange zz..zzz: ";
+   T.forEachInRange(NodeData("zz"), NodeData("zzz"),
+                    [](const NodeData& item) { cout << item << " "; });
+   cout << endl;
+
+   // backwards from end must visit the forward walk in reverse
+   vector<string> forward, backward;
+   for (const NodeData& item : T) {
+      forward.push_back(item.key());
+   }
+   BinTree<NodeData>::const_iterator it = T.end();
+   while (it != T.begin()) {
+      --it;
+      backward.push_back(it->key());
+   }
+   cout << "Backwards: ";
+   for (const string& key : backward) {
+      cout << key << " ";
+   }
+   cout << endl << "Backwards is forward reversed?  "
+        << (equal(forward.rbegin(), forward.rend(), backward.begin()) &&
+            forward.size() == backward.size() ? "yes" : "no") << endl;
+   BinTree<NodeData>::const_iterator last = T.upperBound(NodeData("m"));
+   --last;
+   cout << "-- from upperBound m:  " << last->key() << endl;
+}
+
+//--------------------------- testOrderStatistics ---------------------------
+// Description:
+// select(rank(x)) == x for every item, before and after erasing some, and
+// select out of range and rank of items that are not in the tree
+// Preconditions:    none
+// Postconditions:   results are displayed
+
+void testOrderStatistics(const vector<string>& words) {
+   cout << "---------------------------------------------------------------"
+        << endl;
+   cout << "Order statistics:" << endl;
+   BinTree<NodeData> T;
+   for (const string& w : words) {
+      NodeData* ptr = new NodeData(w);
+      if (!T.insert(ptr)) delete ptr;
+   }
+
+   for (int round = 0; round < 2; round++) {
+      // every item is found again at its own rank, which is its position
+      bool roundTrip = true;
+      int position = 0;
+      for (const NodeData& item : T) {
+         NodeData* p = nullptr;
+         int r = T.rank(item);
+         roundTrip = roundTrip && r == position &&
+                     T.select(r, p) && *p == item;
+         position++;
+      }
+      cout << "Count " << T.getCount() << ", select(rank(x)) == x for every "
+           << "item?  " << (roundTrip ? "yes" : "no") << endl;
+
+      T.erase(NodeData("m"));          // a node with two children
+      T.erase(NodeData("z"));          // the largest
+      T.erase(NodeData("and"));        // the smallest
+   }
+
+   NodeData* p = nullptr;
+   cout << "select(-1): " << (T.select(-1, p) ? "found" : "not found")
+        << "   select(count): "
+        << (T.select(T.getCount(), p) ? "found" : "not found") << endl;
+   T.select(0, p);
+   cout << "select(0): " << *p;
+   T.select(T.getCount() - 1, p);
+   cout << "   select(count - 1): " << *p << endl;
+   cout << "rank of absent a: " << T.rank(NodeData("a"))
+        << "   m: " << T.rank(NodeData("m"))
+        << "   zz: " << T.rank(NodeData("zz")) << endl;
+}
+
+//------------------------------- testDigest --------------------------------
+// Description:
+// trees built from the same words in different orders have equal digests,
+// a tree missing one word does not
+// Preconditions:    none
+// Postconditions:   results are displayed
+
+void testDigest(const vector<string>& words) {
+   cout << "---------------------------------------------------------------"
+        << endl;
+   cout << "Digest:" << endl;
+   BinTree<NodeData> forward, backward, missing;
+   for (const string& w : words) {
+      NodeData* ptr = new NodeData(w);
+      if (!forward.insert(ptr)) delete ptr;
+   }
+   for (int i = words.size() - 1; i >= 0; i--) {
+      NodeData* ptr = new NodeData(words[i]);
+      if (!backward.insert(ptr)) delete ptr;
+   }
+   missing = backward;
+   missing.erase(NodeData("m"));
+
+   cout << "Heights: " << forward.height() << " " << backward.height()
+        << "   forward == backward?  "
+        << (forward == backward ? "equal" : "not equal") << endl;
+   cout << "Digests equal?  "
+        << (forward.digest() == backward.digest() ? "yes" : "no")
+        << "   without m equal?  "
+        << (forward.digest() == missing.digest() ? "yes" : "no") << endl;
+   BinTree<NodeData> empty;
+   cout << "Empty tree digest: " << empty.digest() << endl;
+}
@@ -0,0 +1,269 @@
+// ---------------------------- IntrusiveBinTree.h ----------------------------
+
+// CSS 343
+// Created: October 19th, 2026
+// Last Modified: October 19th, 2026
+
+// ---------------------------------------------------------------------------
+
+// IntrusiveBinTree class: A binary search tree whose links live inside the
+//                   items instead of in separately allocated nodes.
+//                   - ItemType inherits BinTreeHook<ItemType>, which holds
+//                     the left and right links
+//                   - inserting and erasing never allocate or free memory
+//                   - one pointer hop per level instead of node then data
+
+// ---------------------------------------------------------------------------
+
+// Notes on specifications, special algorithms, and assumptions.
+
+//   -- the tree does not own its items; the caller allocates them and
+//      deletes them after they are erased or the tree is emptied, so items
+//      can come from any arena and teardown is O(1)
+//   -- an item can be in at most one IntrusiveBinTree at a time
+//   -- the tree cannot be copied, since copying would need new items
+//   -- operator<< displays the items in an inorder fashion
+//   -- height uses the same definition as BinTree: a leaf has height 1
+
+// ---------------------------------------------------------------------------
+
+#ifndef INTRUSIVEBINTREE_H
+#define INTRUSIVEBINTREE_H
+#include <iostream>
+#include <algorithm>
+using namespace std;
+
+template <typename ItemType>
+class IntrusiveBinTree;
+
+// links embedded in each item, only the tree touches them
+template <typename ItemType>
+class BinTreeHook {
+   friend class IntrusiveBinTree<ItemType>;
+protected:
+   BinTreeHook() : treeLeft(nullptr), treeRight(nullptr) {}
+private:
+   ItemType* treeLeft;                 // left subtree pointer
+   ItemType* treeRight;                // right subtree pointer
+};
+
+template <typename ItemType>
+class IntrusiveBinTree {
+//--------------------------- operator<< ------------------------------------
+// Description:
+// displays the tree using inorder traversal
+// Preconditions:   ItemType class is responsible for displaying its own data
+// Postconditions:  each item in the tree is output onto the screen
+friend ostream& operator<<(ostream& output,
+                           const IntrusiveBinTree<ItemType>& tree) {
+   tree.inorderHelper(output, tree.root);
+   output << endl;
+   return output;
+}
+
+public:
+   IntrusiveBinTree();
+   IntrusiveBinTree(const IntrusiveBinTree &) = delete;
+   IntrusiveBinTree& operator=(const IntrusiveBinTree &) = delete;
+
+   // unlink every item so isEmpty returns true, items are not deleted
+   void makeEmpty();
+
+   // true if tree is empty, otherwise false
+   bool isEmpty() const;
+
+   // true if the item is linked into the tree, false if it is a duplicate
+   bool insert(ItemType*);
+
+   // retrieve an item based on ItemType from the tree
+   bool retrieve(const ItemType &, ItemType* &) const;
+
+   // unlink an item from the tree, p points to it for the caller to delete
+   bool erase(const ItemType &, ItemType* &);
+
+   // get the current height of the tree
+   int height() const;
+
+   // get the total number of items in the tree
+   int getCount() const;
+
+private:
+   ItemType* root;                     // root of the tree
+   int itemCount;                      // number of items linked in
+
+   // recursive helpers
+   bool insertHelper(ItemType*, ItemType*&);
+   bool eraseHelper(ItemType*&, const ItemType&, ItemType*&);
+   ItemType* unlinkSmallest(ItemType*&);
+   int heightHelper(const ItemType*) const;
+   ostream& inorderHelper(ostream&, const ItemType*) const;
+};
+
+//----------------------- Default Constructor --------------------------------
+// Postconditions:  root is set to nullptr
+template <typename ItemType>
+IntrusiveBinTree<ItemType>::IntrusiveBinTree() {
+   root = nullptr;
+   itemCount = 0;
+}
+
+//----------------------------- makeEmpty ------------------------------------
+// Description:
+// forgets every item; the items keep stale links until they are inserted
+// again, which resets them
+// Postconditions:  root is null
+template <typename ItemType>
+void IntrusiveBinTree<ItemType>::makeEmpty() {
+   root = nullptr;
+   itemCount = 0;
+}
+
+// ------------------------------ isEmpty ------------------------------------
+template <typename ItemType>
+bool IntrusiveBinTree<ItemType>::isEmpty() const {
+   return root == nullptr;
+}
+
+//------------------------------- getCount ------------------------------------
+template <typename ItemType>
+int IntrusiveBinTree<ItemType>::getCount() const {
+   return itemCount;
+}
+
+// ------------------------------ insert -------------------------------------
+// Description:
+// links newItem into the tree as a new leaf
+// Preconditions:   newItem is not linked into another tree
+// Postconditions:  return true if linked in, false for a duplicate
+template <typename ItemType>
+bool IntrusiveBinTree<ItemType>::insert(ItemType* newItem) {
+   newItem->treeLeft = newItem->treeRight = nullptr;
+   if(insertHelper(newItem, root)) {
+      itemCount++;
+      return true;
+   }
+   return false;
+}
+
+//--------------------------- insertHelper -----------------------------------
+template <typename ItemType>
+bool IntrusiveBinTree<ItemType>::insertHelper(ItemType* newItem,
+                                              ItemType*& current) {
+   if(current == nullptr) {
+      current = newItem;
+      return true;
+   }
+   else if(*current > *newItem) {
+      return insertHelper(newItem, current->treeLeft);
+   }
+   else if(*current < *newItem) {
+      return insertHelper(newItem, current->treeRight);
+   }
+   return false;
+}
+
+//------------------------------- retrieve -----------------------------------
+// Postconditions:  return true if the target was found and p is pointing to
+//                  the item in the tree, return false otherwise
+template <typename ItemType>
+bool IntrusiveBinTree<ItemType>::retrieve(const ItemType& target,
+                                          ItemType*& p) const {
+   ItemType* current = root;
+   while(current != nullptr) {
+      if(*current == target) {
+         p = current;
+         return true;
+      }
+      current = (*current < target) ? current->treeRight : current->treeLeft;
+   }
+   return false;
+}
+
+//---------------------------------- erase ------------------------------------
+// Description:
+// unlinks the item equal to target; an item with two children is replaced
+// by the smallest item of its right subtree
+// Postconditions: return true and p is pointing to the unlinked item
+//                 return false otherwise
+template <typename ItemType>
+bool IntrusiveBinTree<ItemType>::erase(const ItemType& target, ItemType*& p) {
+   if(eraseHelper(root, target, p)) {
+      itemCount--;
+      return true;
+   }
+   return false;
+}
+
+//------------------------------- eraseHelper ---------------------------------
+template <typename ItemType>
+bool IntrusiveBinTree<ItemType>::eraseHelper(ItemType*& current,
+                                    const ItemType& target, ItemType*& p) {
+   if(current == nullptr) {
+      return false;
+   }
+   else if(*current < target) {
+      return eraseHelper(current->treeRight, target, p);
+   }
+   else if(*current > target) {
+      return eraseHelper(current->treeLeft, target, p);
+   }
+
+   p = current;
+   if(current->treeLeft == nullptr) {
+      current = current->treeRight;
+   }
+   else if(current->treeRight == nullptr) {
+      current = current->treeLeft;
+   }
+   else {
+      // the successor takes over both of p's subtrees
+      ItemType* successor = unlinkSmallest(current->treeRight);
+      successor->treeLeft = p->treeLeft;
+      successor->treeRight = p->treeRight;
+      current = successor;
+   }
+   p->treeLeft = p->treeRight = nullptr;
+   return true;
+}
+
+//----------------------------- unlinkSmallest --------------------------------
+// Postconditions: the smallest item of the subtree is unlinked and returned
+template <typename ItemType>
+ItemType* IntrusiveBinTree<ItemType>::unlinkSmallest(ItemType*& current) {
+   if(current->treeLeft == nullptr) {
+      ItemType* smallest = current;
+      current = current->treeRight;
+      return smallest;
+   }
+   return unlinkSmallest(current->treeLeft);
+}
+
+//--------------------------------- height ------------------------------------
+template <typename ItemType>
+int IntrusiveBinTree<ItemType>::height() const {
+   return heightHelper(root);
+}
+
+template <typename ItemType>
+int IntrusiveBinTree<ItemType>::heightHelper(const ItemType* current) const {
+   if(current == nullptr) {
+      return 0;
+   }
+   return 1 + max(heightHelper(current->treeLeft),
+                  heightHelper(current->treeRight));
+}
+
+//----------------------------- inorderHelper --------------------------------
+template <typename ItemType>
+ostream& IntrusiveBinTree<ItemType>::inorderHelper(ostream& output,
+                                         const ItemType* current) const {
+   if(current == nullptr) {
+      return output;
+   }
+   inorderHelper(output, current->treeLeft);
+   output << *current << " ";
+   inorderHelper(output, current->treeRight);
+   return output;
+}
+
+#endif
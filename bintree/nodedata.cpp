@@ -43,6 +43,16 @@ bool NodeData::operator>=(const NodeData& rhs) const {
    return data >= rhs.data;
 }
 
+//------------------------------- hash ---------------------------------------
+size_t NodeData::hash() const {
+   return std::hash<string>()(data);
+}
+
+//-------------------------------- key ---------------------------------------
+const string& NodeData::key() const {
+   return data;
+}
+
 //------------------------------ setData -------------------------------------
 // returns true if the data is set, false when bad data, i.e., is eof
 
@@ -3,6 +3,7 @@
 #include <string>
 #include <iostream>
 #include <fstream>
+#include <functional>
 using namespace std;
 
 // simple class containing one string to use for testing
@@ -29,8 +30,18 @@ public:
    bool operator<=(const NodeData &) const;
    bool operator>=(const NodeData &) const;
 
+   size_t hash() const;           // hash of the string, for std::hash
+   const string& key() const;     // the string itself, for RadixTree
+
 private:
    string data;
 };
 
+namespace std {
+template <>
+struct hash<NodeData> {
+   size_t operator()(const NodeData& nd) const { return nd.hash(); }
+};
+}
+
 #endif
@@ -0,0 +1,218 @@
+// -------------------------------- NodePool.h --------------------------------
+
+// CSS 343
+// Created: October 19th, 2026
+// Last Modified: October 19th, 2026
+
+// ---------------------------------------------------------------------------
+
+// Node allocator policies for BinTree. A policy is a class template over the
+// node type with this interface:
+//    Node* allocate();            an uninitialized node
+//    void deallocate(Node*);      give one node back
+//    void release();              give back every node allocated so far
+//    void absorb(Policy&);        take over the nodes of another allocator
+//    static const bool RELEASES_ALL
+//                                 true if release() frees the nodes, so the
+//                                 tree can skip deallocating them one by one
+
+// NodePool class:   slab allocator, the default policy
+//                   - nodes are carved out of blocks that double in size,
+//                     so n nodes live in about log(n) blocks
+//                   - deallocated nodes go on a free list for reuse
+//                   - release() frees every block, which is how a tree is
+//                     torn down without one delete per node
+
+// NodeHeap class:   one new/delete per node, same as before pools existed
+
+// ---------------------------------------------------------------------------
+
+// Notes on specifications, special algorithms, and assumptions.
+
+//   -- a pool belongs to one tree and is not safe to share between threads
+//   -- Node must be trivially destructible; the pool never runs destructors
+//   -- pools cannot be copied, a copied tree allocates from its own pool
+
+// ---------------------------------------------------------------------------
+
+#ifndef NODEPOOL_H
+#define NODEPOOL_H
+#include <cstddef>
+#include <new>
+using namespace std;
+
+template <typename Node>
+class NodePool {
+public:
+   static const bool RELEASES_ALL = true;
+
+   NodePool();
+   ~NodePool();
+   NodePool(const NodePool &) = delete;
+   NodePool& operator=(const NodePool &) = delete;
+
+   // get storage for one node, from the free list if possible
+   Node* allocate();
+
+   // put a node on the free list
+   void deallocate(Node*);
+
+   // free every block, all nodes from this pool become invalid
+   void release();
+
+   // take ownership of every block of other, other is left empty
+   void absorb(NodePool &);
+
+private:
+   static const int FIRST_BLOCK = 64;          // nodes in the first block
+   static const int LARGEST_BLOCK = 1 << 20;   // block size stops doubling
+
+   union Slot {
+      Slot* nextFree;                          // link while on the free list
+      alignas(Node) unsigned char storage[sizeof(Node)];
+   };
+   struct Block {
+      Block* next;                             // blocks form a linked list
+      int capacity;                            // number of slots in block
+      Slot* slots() { return reinterpret_cast<Slot*>(this + 1); }
+   };
+
+   Block* blocks;                              // most recent block first
+   int used;                                   // slots handed out of blocks
+   Slot* freeList;                             // deallocated slots
+
+   void grow();
+};
+
+template <typename Node>
+class NodeHeap {
+public:
+   static const bool RELEASES_ALL = false;
+
+   Node* allocate() { return new Node; }
+   void deallocate(Node* node) { delete node; }
+   void release() {}
+   void absorb(NodeHeap &) {}
+};
+
+//------------------------------ Constructor ---------------------------------
+// Postconditions:  the pool has no blocks
+template <typename Node>
+NodePool<Node>::NodePool() {
+   blocks = nullptr;
+   used = 0;
+   freeList = nullptr;
+}
+
+//------------------------------- Destructor ---------------------------------
+// Postconditions:  every block is freed
+template <typename Node>
+NodePool<Node>::~NodePool() {
+   release();
+}
+
+//------------------------------- allocate -----------------------------------
+// Description:
+// reuse a freed slot if there is one, otherwise take the next unused slot of
+// the newest block, adding a block when it is full
+template <typename Node>
+Node* NodePool<Node>::allocate() {
+   Slot* slot;
+   if(freeList != nullptr) {
+      slot = freeList;
+      freeList = freeList->nextFree;
+   }
+   else {
+      if(blocks == nullptr || used == blocks->capacity) {
+         grow();
+      }
+      slot = blocks->slots() + used;
+      used++;
+   }
+   return new (slot->storage) Node;
+}
+
+//------------------------------ deallocate ----------------------------------
+// Description:
+// the slot goes to the front of the free list
+template <typename Node>
+void NodePool<Node>::deallocate(Node* node) {
+   Slot* slot = reinterpret_cast<Slot*>(node);
+   slot->nextFree = freeList;
+   freeList = slot;
+}
+
+//-------------------------------- release -----------------------------------
+// Description:
+// frees every block at once
+// Postconditions:  the pool is empty
+template <typename Node>
+void NodePool<Node>::release() {
+   while(blocks != nullptr) {
+      Block* next = blocks->next;
+      ::operator delete(blocks);
+      blocks = next;
+   }
+   used = 0;
+   freeList = nullptr;
+}
+
+//--------------------------------- absorb -----------------------------------
+// Description:
+// splices the blocks of other behind this pool's newest block, so the nodes
+// handed out by other now belong to *this; unused slots at the end of
+// other's newest block are put on the free list
+// Postconditions:  other is empty
+template <typename Node>
+void NodePool<Node>::absorb(NodePool<Node>& other) {
+   if(&other == this || other.blocks == nullptr) {
+      return;
+   }
+   for(int i = other.used; i < other.blocks->capacity; i++) {
+      Slot* slot = other.blocks->slots() + i;
+      slot->nextFree = freeList;
+      freeList = slot;
+   }
+   while(other.freeList != nullptr) {
+      Slot* slot = other.freeList;
+      other.freeList = slot->nextFree;
+      slot->nextFree = freeList;
+      freeList = slot;
+   }
+
+   // other's blocks are full from here on, keep ours at the front
+   Block* last = other.blocks;
+   while(last->next != nullptr) {
+      last = last->next;
+   }
+   if(blocks == nullptr) {
+      blocks = other.blocks;
+      used = blocks->capacity;
+   }
+   else {
+      last->next = blocks->next;
+      blocks->next = other.blocks;
+   }
+   other.blocks = nullptr;
+   other.used = 0;
+}
+
+//---------------------------------- grow ------------------------------------
+// Description:
+// adds a block twice the size of the previous one, up to LARGEST_BLOCK
+template <typename Node>
+void NodePool<Node>::grow() {
+   int capacity = FIRST_BLOCK;
+   if(blocks != nullptr) {
+      capacity = (blocks->capacity < LARGEST_BLOCK) ?
+                  blocks->capacity * 2 : LARGEST_BLOCK;
+   }
+   void* memory = ::operator new(sizeof(Block) + capacity * sizeof(Slot));
+   Block* block = static_cast<Block*>(memory);
+   block->next = blocks;
+   block->capacity = capacity;
+   blocks = block;
+   used = 0;
+}
+
+#endif
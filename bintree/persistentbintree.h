@@ -0,0 +1,420 @@
+// --------------------------- PersistentBinTree.h ----------------------------
+
+// CSS 343
+// Created: October 19th, 2026
+// Last Modified: October 19th, 2026
+
+// ---------------------------------------------------------------------------
+
+// PersistentBinTree class: A binary search tree whose versions share nodes.
+//                   - Nodes are immutable and reference counted.
+//                   - insert and erase copy only the nodes on the path from
+//                     the root to the change; every other node is shared
+//                     with the previous version.
+//                   - snapshot(), the copy constructor and operator= just
+//                     share the root, so taking a point-in-time copy is O(1)
+//                     instead of a deep copy of every node.
+
+// ---------------------------------------------------------------------------
+
+// Notes on specifications, special algorithms, and assumptions.
+
+//   -- the tree takes ownership of inserted ItemType* like BinTree does; an
+//      item is deleted when the last version that contains it goes away,
+//      a duplicate is not inserted and stays with the caller
+//   -- a snapshot never changes, later updates to the tree it was taken
+//      from build new paths instead of touching shared nodes
+//   -- reference counts are atomic, so a snapshot may be read by other
+//      threads while the original keeps being updated by its owner
+//   -- the pointer handed out by retrieve stays valid while this tree or any
+//      snapshot still contains the item
+//   -- operator== is content equality; versions that share a root compare
+//      equal without walking
+//   -- operations are O(height); the tree is not rebalanced
+
+// ---------------------------------------------------------------------------
+
+#ifndef PERSISTENTBINTREE_H
+#define PERSISTENTBINTREE_H
+#include <iostream>
+#include <memory>
+#include <vector>
+using namespace std;
+
+template <typename ItemType>
+class PersistentBinTree {
+//--------------------------- operator<< ------------------------------------
+// Description:
+// displays the tree using inorder traversal
+// Preconditions:   ItemType class is responsible for displaying its own data
+// Postconditions:  each node in the tree is output onto the screen
+friend ostream& operator<<(ostream& output,
+                           const PersistentBinTree<ItemType>& tree) {
+   tree.inorderHelper(output, tree.root.get());
+   output << endl;
+   return output;
+}
+
+public:
+   PersistentBinTree();                          // constructor
+
+   // copies share every node with right, O(1)
+   PersistentBinTree(const PersistentBinTree &);
+   PersistentBinTree& operator=(const PersistentBinTree &);
+
+   // O(1) point-in-time copy of the tree
+   PersistentBinTree snapshot() const;
+
+   bool operator==(const PersistentBinTree &) const;
+   bool operator!=(const PersistentBinTree &) const;
+
+   // make the tree empty so isEmpty returns true, snapshots are unaffected
+   void makeEmpty();
+
+   // true if tree is empty, otherwise false
+   bool isEmpty() const;
+
+   // true if a node is inserted, false for a duplicate, which the caller
+   // still owns
+   bool insert(ItemType*);
+
+   // retrieve an item based on ItemType from the tree
+   bool retrieve(const ItemType &, const ItemType* &) const;
+
+   // remove a node based on ItemType from the tree
+   bool erase(const ItemType &);
+
+   // get the total number of nodes in the tree
+   int getCount() const;
+
+   // call fn on every item with lo <= item <= hi, in sorted order
+   template <typename Function>
+   void forEachInRange(const ItemType &, const ItemType &, Function) const;
+
+private:
+   struct Node;
+   typedef shared_ptr<const Node> NodePtr;
+
+   struct Node {
+      shared_ptr<const ItemType> data;  // shared by all copies of the node
+      NodePtr left;                     // left subtree pointer
+      NodePtr right;                    // right subtree pointer
+      int count;                        // number of nodes in this subtree
+   };
+
+   NodePtr root;                        // root of this version
+
+   // a node like current but with new children
+   static NodePtr copyNode(const Node*, const NodePtr&, const NodePtr&);
+   static int subtreeCount(const NodePtr&);
+
+   // path copying helpers
+   NodePtr insertHelper(const NodePtr&, ItemType*, bool&);
+   NodePtr eraseHelper(const NodePtr&, const ItemType&, bool&);
+   NodePtr removeSmallest(const NodePtr&, NodePtr&);
+
+   // helpers for reading
+   template <typename Function>
+   void rangeHelper(const ItemType&, const ItemType&, Function&,
+                    const Node*) const;
+   void inorderHelper(ostream&, const Node*) const;
+   static void pushLeftmost(vector<const Node*>&, const Node*);
+};
+
+//----------------------- Default Constructor --------------------------------
+// Postconditions:  root is empty
+template <typename ItemType>
+PersistentBinTree<ItemType>::PersistentBinTree() {
+}
+
+//------------------------- Copy Constructor ---------------------------------
+// Description:
+// shares the root of right, no nodes are copied
+template <typename ItemType>
+PersistentBinTree<ItemType>::PersistentBinTree(const PersistentBinTree& right)
+                                                     : root(right.root) {
+}
+
+//----------------------------- operator= ------------------------------------
+// Description:
+// shares the root of right, the old version is released
+template <typename ItemType>
+PersistentBinTree<ItemType>& PersistentBinTree<ItemType>::operator=(
+                                             const PersistentBinTree& right) {
+   root = right.root;
+   return *this;
+}
+
+//------------------------------ snapshot ------------------------------------
+// Description:
+// a read-only point-in-time version of the tree
+// Postconditions:  the returned tree does not see later updates to *this
+template <typename ItemType>
+PersistentBinTree<ItemType> PersistentBinTree<ItemType>::snapshot() const {
+   return *this;
+}
+
+//----------------------------- operator== -----------------------------------
+// Description:
+// two trees are equal if they hold the same items in the same order; the
+// trees are walked in order side by side and stop at the first difference
+template <typename ItemType>
+bool PersistentBinTree<ItemType>::operator==(
+                                    const PersistentBinTree& right) const {
+   if(root == right.root) {
+      return true;
+   }
+   if(getCount() != right.getCount()) {
+      return false;
+   }
+   vector<const Node*> mine, theirs;
+   pushLeftmost(mine, root.get());
+   pushLeftmost(theirs, right.root.get());
+   while(!mine.empty() && !theirs.empty()) {
+      const Node* a = mine.back();
+      const Node* b = theirs.back();
+      mine.pop_back();
+      theirs.pop_back();
+      // a shared node has the same item and the same right subtree, so the
+      // walks skip that subtree instead of comparing it
+      if(a != b) {
+         if(*a->data != *b->data) {
+            return false;
+         }
+         pushLeftmost(mine, a->right.get());
+         pushLeftmost(theirs, b->right.get());
+      }
+   }
+   return mine.empty() && theirs.empty();
+}
+
+//----------------------------- operator!= -----------------------------------
+template <typename ItemType>
+bool PersistentBinTree<ItemType>::operator!=(
+                                    const PersistentBinTree& right) const {
+   return !(*this == right);
+}
+
+//------------------------------ pushLeftmost --------------------------------
+template <typename ItemType>
+void PersistentBinTree<ItemType>::pushLeftmost(vector<const Node*>& path,
+                                               const Node* current) {
+   while(current != nullptr) {
+      path.push_back(current);
+      current = current->left.get();
+   }
+}
+
+//----------------------------- makeEmpty ------------------------------------
+// Description:
+// drops this version; nodes still used by a snapshot stay alive
+template <typename ItemType>
+void PersistentBinTree<ItemType>::makeEmpty() {
+   root.reset();
+}
+
+// ------------------------------ isEmpty ------------------------------------
+template <typename ItemType>
+bool PersistentBinTree<ItemType>::isEmpty() const {
+   return root == nullptr;
+}
+
+//------------------------------- getCount ------------------------------------
+template <typename ItemType>
+int PersistentBinTree<ItemType>::getCount() const {
+   return subtreeCount(root);
+}
+
+template <typename ItemType>
+int PersistentBinTree<ItemType>::subtreeCount(const NodePtr& current) {
+   return (current == nullptr) ? 0 : current->count;
+}
+
+//------------------------------- copyNode -----------------------------------
+// Description:
+// a copy of current with different children, the data is shared
+template <typename ItemType>
+typename PersistentBinTree<ItemType>::NodePtr
+PersistentBinTree<ItemType>::copyNode(const Node* current,
+                                      const NodePtr& left,
+                                      const NodePtr& right) {
+   shared_ptr<Node> copy = make_shared<Node>();
+   copy->data = current->data;
+   copy->left = left;
+   copy->right = right;
+   copy->count = subtreeCount(left) + subtreeCount(right) + 1;
+   return copy;
+}
+
+// ------------------------------ insert -------------------------------------
+// Description:
+// this version gets a new path from the root down to a new leaf
+// Preconditions:   ItemType newData has been allocated
+// Postconditions:  return true if inserted, a duplicate is left with the
+//                  caller
+template <typename ItemType>
+bool PersistentBinTree<ItemType>::insert(ItemType* newData) {
+   bool inserted = false;
+   NodePtr newRoot = insertHelper(root, newData, inserted);
+   if(inserted) {
+      root = newRoot;
+   }
+   return inserted;
+}
+
+//--------------------------- insertHelper -----------------------------------
+// Postconditions:  returns the root of the new version of the subtree,
+//                  current itself if newData is a duplicate; newData is
+//                  owned by the new leaf only once it is linked
+template <typename ItemType>
+typename PersistentBinTree<ItemType>::NodePtr
+PersistentBinTree<ItemType>::insertHelper(const NodePtr& current,
+                              ItemType* newData, bool& inserted) {
+   if(current == nullptr) {
+      shared_ptr<Node> leaf = make_shared<Node>();
+      leaf->data = shared_ptr<const ItemType>(newData);
+      leaf->count = 1;
+      inserted = true;
+      return leaf;
+   }
+   if(*newData < *current->data) {
+      NodePtr left = insertHelper(current->left, newData, inserted);
+      return inserted ? copyNode(current.get(), left, current->right)
+                      : current;
+   }
+   if(*current->data < *newData) {
+      NodePtr right = insertHelper(current->right, newData, inserted);
+      return inserted ? copyNode(current.get(), current->left, right)
+                      : current;
+   }
+   return current;                      // duplicate
+}
+
+//------------------------------- retrieve -----------------------------------
+// Postconditions:  return true if the target was found and p is pointing to
+//                  the item, return false otherwise
+template <typename ItemType>
+bool PersistentBinTree<ItemType>::retrieve(const ItemType& target,
+                                           const ItemType*& p) const {
+   const Node* current = root.get();
+   while(current != nullptr) {
+      if(*current->data == target) {
+         p = current->data.get();
+         return true;
+      }
+      current = (*current->data < target) ? current->right.get()
+                                          : current->left.get();
+   }
+   return false;
+}
+
+//---------------------------------- erase ------------------------------------
+// Description:
+// this version gets a new path from the root to where target was
+// Postconditions: return true if target was found and erased
+template <typename ItemType>
+bool PersistentBinTree<ItemType>::erase(const ItemType& target) {
+   bool erased = false;
+   NodePtr newRoot = eraseHelper(root, target, erased);
+   if(erased) {
+      root = newRoot;
+   }
+   return erased;
+}
+
+//------------------------------- eraseHelper ---------------------------------
+// Description:
+// a node with two children is replaced by a copy holding the smallest item
+// of its right subtree
+// Postconditions: returns the root of the new version of the subtree
+template <typename ItemType>
+typename PersistentBinTree<ItemType>::NodePtr
+PersistentBinTree<ItemType>::eraseHelper(const NodePtr& current,
+                                         const ItemType& target,
+                                         bool& erased) {
+   if(current == nullptr) {
+      return current;
+   }
+   if(target < *current->data) {
+      NodePtr left = eraseHelper(current->left, target, erased);
+      return erased ? copyNode(current.get(), left, current->right)
+                    : current;
+   }
+   if(*current->data < target) {
+      NodePtr right = eraseHelper(current->right, target, erased);
+      return erased ? copyNode(current.get(), current->left, right)
+                    : current;
+   }
+
+   erased = true;
+   if(current->left == nullptr) {
+      return current->right;
+   }
+   if(current->right == nullptr) {
+      return current->left;
+   }
+   NodePtr smallest;
+   NodePtr right = removeSmallest(current->right, smallest);
+   return copyNode(smallest.get(), current->left, right);
+}
+
+//----------------------------- removeSmallest --------------------------------
+// Postconditions: returns the new version of the subtree without its
+//                 smallest node, smallest is that node
+template <typename ItemType>
+typename PersistentBinTree<ItemType>::NodePtr
+PersistentBinTree<ItemType>::removeSmallest(const NodePtr& current,
+                                            NodePtr& smallest) {
+   if(current->left == nullptr) {
+      smallest = current;
+      return current->right;
+   }
+   NodePtr left = removeSmallest(current->left, smallest);
+   return copyNode(current.get(), left, current->right);
+}
+
+//----------------------------- forEachInRange -------------------------------
+// Description:
+// calls fn(const ItemType&) on each item between lo and hi (inclusive) in
+// sorted order
+template <typename ItemType>
+template <typename Function>
+void PersistentBinTree<ItemType>::forEachInRange(const ItemType& lo,
+                                    const ItemType& hi, Function fn) const {
+   rangeHelper(lo, hi, fn, root.get());
+}
+
+template <typename ItemType>
+template <typename Function>
+void PersistentBinTree<ItemType>::rangeHelper(const ItemType& lo,
+                                    const ItemType& hi, Function& fn,
+                                    const Node* current) const {
+   if(current == nullptr) {
+      return;
+   }
+   bool aboveLo = *current->data >= lo;
+   bool belowHi = *current->data <= hi;
+   if(aboveLo) {
+      rangeHelper(lo, hi, fn, current->left.get());
+   }
+   if(aboveLo && belowHi) {
+      fn(*current->data);
+   }
+   if(belowHi) {
+      rangeHelper(lo, hi, fn, current->right.get());
+   }
+}
+
+//----------------------------- inorderHelper --------------------------------
+template <typename ItemType>
+void PersistentBinTree<ItemType>::inorderHelper(ostream& output,
+                                                const Node* current) const {
+   if(current == nullptr) {
+      return;
+   }
+   inorderHelper(output, current->left.get());
+   output << *current->data << " ";
+   inorderHelper(output, current->right.get());
+}
+
+#endif
@@ -0,0 +1,868 @@
+// ------------------------------- RadixTree.h --------------------------------
+
+// CSS 343
+// Created: October 19th, 2026
+// Last Modified: October 19th, 2026
+
+// ---------------------------------------------------------------------------
+
+// RadixTree class:  A compressed trie over string keys with adaptive nodes.
+//                   - each edge is one key byte plus a compressed run of
+//                     bytes (the prefix) shared by everything below it, so
+//                     a lookup compares each key byte once instead of
+//                     comparing whole strings at every level like BinTree
+//                   - a node holds its children in the smallest of four
+//                     layouts that fits: 4 or 16 sorted key bytes, a 256
+//                     byte index into 48 slots, or 256 direct slots; nodes
+//                     grow and shrink between layouts as children come and
+//                     go
+//                   - items come out in the same order as std::string's
+//                     operator<, and every key with a given prefix lives in
+//                     one subtree, so prefix search does not scan
+
+// ---------------------------------------------------------------------------
+
+// Notes on specifications, special algorithms, and assumptions.
+
+//   -- ItemType has a member const string& key() const, which is what the
+//      tree is ordered by (NodeData provides it); items with equal keys are
+//      duplicates
+//   -- like BinTree, the tree owns inserted items and a duplicate is not
+//      inserted, the caller keeps ownership of it
+//   -- const_iterator is forward only and walks the items in sorted order;
+//      inserting or erasing invalidates iterators
+//   -- forEachWithPrefix calls fn on every item whose key starts with the
+//      prefix, in sorted order; an empty prefix visits every item
+//   -- a node shrinks only once it is well below the smaller layout's size,
+//      so a node near a boundary does not flip layouts on every update
+
+// ---------------------------------------------------------------------------
+
+#ifndef RADIXTREE_H
+#define RADIXTREE_H
+#include <iostream>
+#include <string>
+#include <vector>
+#include <iterator>
+#include <cstring>
+using namespace std;
+
+template <typename ItemType>
+class RadixTree {
+//--------------------------- operator<< ------------------------------------
+// Description:
+// displays the items in sorted order
+// Preconditions:   ItemType class is responsible for displaying its own data
+// Postconditions:  each item in the tree is output onto the screen
+friend ostream& operator<<(ostream& output, const RadixTree<ItemType>& tree) {
+   for(const ItemType& item : tree) {
+      output << item << " ";
+   }
+   output << endl;
+   return output;
+}
+
+private:
+   struct Node;                        // tree node, defined below
+
+public:
+   RadixTree();                        // constructor
+   RadixTree(const RadixTree &);       // copy constructor
+   ~RadixTree();                       // destructor, calls makeEmpty
+   RadixTree& operator=(const RadixTree &);
+
+   // make the tree empty so isEmpty returns true
+   void makeEmpty();
+
+   // true if tree is empty, otherwise false
+   bool isEmpty() const;
+
+   // true if the item is inserted, false if its key is already present
+   bool insert(ItemType*);
+
+   // retrieve the item with the same key as the target
+   bool retrieve(const ItemType &, ItemType* &) const;
+
+   // remove the item with the same key as the target
+   bool erase(const ItemType &);
+
+   // get the total number of items in the tree
+   int getCount() const;
+
+   // call fn on every item whose key starts with prefix, in sorted order
+   template <typename Function>
+   void forEachWithPrefix(const string &, Function) const;
+
+   // forward iterator over the items in sorted order
+   class const_iterator {
+   public:
+      typedef forward_iterator_tag iterator_category;
+      typedef ItemType value_type;
+      typedef ptrdiff_t difference_type;
+      typedef const ItemType* pointer;
+      typedef const ItemType& reference;
+
+      const_iterator() {}
+      const ItemType& operator*() const { return *path.back().node->data; }
+      const ItemType* operator->() const { return path.back().node->data; }
+      const_iterator& operator++();
+      const_iterator operator++(int) {
+         const_iterator old = *this;
+         ++*this;
+         return old;
+      }
+      bool operator==(const const_iterator& rhs) const {
+         return path.empty() ? rhs.path.empty()
+                  : (!rhs.path.empty() && path.back().node ==
+                                          rhs.path.back().node);
+      }
+      bool operator!=(const const_iterator& rhs) const {
+         return !(*this == rhs);
+      }
+   private:
+      friend class RadixTree;
+      struct Frame {
+         const Node* node;
+         int next;                     // first child byte not yet visited
+      };
+      vector<Frame> path;              // root to current node, empty at end
+   };
+   typedef const_iterator iterator;
+
+   const_iterator begin() const;
+   const_iterator end() const;
+
+private:
+   enum { NODE4, NODE16, NODE48, NODE256 };
+
+   struct Node {
+      string prefix;                   // bytes after the parent's branch byte
+      ItemType* data;                  // item whose key ends here, or null
+      unsigned char kind;              // which layout the children use
+      int count;                       // number of children
+   };
+   template <int N>
+   struct SortedNode : Node {          // NODE4 and NODE16
+      unsigned char keys[N];           // child bytes in increasing order
+      Node* children[N];
+   };
+   typedef SortedNode<4> Node4;
+   typedef SortedNode<16> Node16;
+   struct Node48 : Node {
+      unsigned char index[256];        // slot + 1 for each byte, 0 if none
+      Node* children[48];              // slots 0 .. count-1 are used
+   };
+   struct Node256 : Node {
+      Node* children[256];             // indexed by byte, null if none
+   };
+
+   Node* root;                         // root of the tree
+   int itemCount;                      // number of items in the tree
+
+   // node layouts
+   static Node* newNode(int);
+   static void freeNode(Node*);
+   static Node* resize(Node*, int);
+   static Node** childArray(Node*, int&);
+
+   // child access by key byte
+   static Node** findChild(Node*, unsigned char);
+   static bool nextChild(const Node*, int, int&, Node*&);
+   static void addChild(Node*&, unsigned char, Node*);
+   static void removeChild(Node*&, unsigned char);
+
+   // number of bytes of current's prefix that key matches from depth on
+   static size_t matchPrefix(const Node*, const string&, size_t);
+
+   // a childless node holding the item, with the rest of the key as prefix
+   static Node* newLeaf(const string&, size_t, ItemType*);
+
+   // recursive helpers
+   bool eraseHelper(Node*&, const string&, size_t);
+   static void compact(Node*&);
+   static Node* copyHelper(const Node*);
+   static void makeEmptyHelper(Node*);
+   template <typename Function>
+   static void walkHelper(const Node*, Function&);
+};
+
+//----------------------- Default Constructor --------------------------------
+// Postconditions:  root is set to nullptr
+template <typename ItemType>
+RadixTree<ItemType>::RadixTree() {
+   root = nullptr;
+   itemCount = 0;
+}
+
+//------------------------- Copy Constructor ---------------------------------
+// Description:
+// deep copies the nodes and items of right
+template <typename ItemType>
+RadixTree<ItemType>::RadixTree(const RadixTree& right) {
+   root = copyHelper(right.root);
+   itemCount = right.itemCount;
+}
+
+//---------------------------- Destructor ------------------------------------
+template <typename ItemType>
+RadixTree<ItemType>::~RadixTree() {
+   makeEmpty();
+}
+
+//----------------------------- operator= ------------------------------------
+template <typename ItemType>
+RadixTree<ItemType>& RadixTree<ItemType>::operator=(const RadixTree& right) {
+   if(&right != this) {
+      makeEmpty();
+      root = copyHelper(right.root);
+      itemCount = right.itemCount;
+   }
+   return *this;
+}
+
+//----------------------------- makeEmpty ------------------------------------
+// Postconditions:  every node and item is deleted, root is null
+template <typename ItemType>
+void RadixTree<ItemType>::makeEmpty() {
+   makeEmptyHelper(root);
+   root = nullptr;
+   itemCount = 0;
+}
+
+template <typename ItemType>
+void RadixTree<ItemType>::makeEmptyHelper(Node* current) {
+   if(current == nullptr) {
+      return;
+   }
+   int size;
+   Node** children = childArray(current, size);
+   for(int i = 0; i < size; i++) {
+      makeEmptyHelper(children[i]);
+   }
+   delete current->data;
+   freeNode(current);
+}
+
+//---------------------------- copyHelper ------------------------------------
+// Description:
+// copies current in the same layout, then replaces the copied child
+// pointers and item with deep copies
+template <typename ItemType>
+typename RadixTree<ItemType>::Node*
+RadixTree<ItemType>::copyHelper(const Node* current) {
+   if(current == nullptr) {
+      return nullptr;
+   }
+   Node* copy;
+   switch(current->kind) {
+   case NODE4:
+      copy = new Node4(*static_cast<const Node4*>(current));
+      break;
+   case NODE16:
+      copy = new Node16(*static_cast<const Node16*>(current));
+      break;
+   case NODE48:
+      copy = new Node48(*static_cast<const Node48*>(current));
+      break;
+   default:
+      copy = new Node256(*static_cast<const Node256*>(current));
+      break;
+   }
+   if(copy->data != nullptr) {
+      copy->data = new ItemType(*copy->data);
+   }
+   int size;
+   Node** children = childArray(copy, size);
+   for(int i = 0; i < size; i++) {
+      children[i] = copyHelper(children[i]);
+   }
+   return copy;
+}
+
+// ------------------------------ isEmpty ------------------------------------
+template <typename ItemType>
+bool RadixTree<ItemType>::isEmpty() const {
+   return root == nullptr;
+}
+
+//------------------------------- getCount ------------------------------------
+template <typename ItemType>
+int RadixTree<ItemType>::getCount() const {
+   return itemCount;
+}
+
+//------------------------------- newNode -------------------------------------
+// Description:
+// an empty node of the given layout
+template <typename ItemType>
+typename RadixTree<ItemType>::Node* RadixTree<ItemType>::newNode(int kind) {
+   Node* node;
+   switch(kind) {
+   case NODE4:
+      node = new Node4;
+      break;
+   case NODE16:
+      node = new Node16;
+      break;
+   case NODE48: {
+      Node48* node48 = new Node48;
+      memset(node48->index, 0, sizeof(node48->index));
+      node = node48;
+      break;
+   }
+   default: {
+      Node256* node256 = new Node256;
+      for(int i = 0; i < 256; i++) {
+         node256->children[i] = nullptr;
+      }
+      node = node256;
+      break;
+   }
+   }
+   node->data = nullptr;
+   node->kind = kind;
+   node->count = 0;
+   return node;
+}
+
+//------------------------------- freeNode ------------------------------------
+// Description:
+// deletes the node as its own layout, the item and children are not touched
+template <typename ItemType>
+void RadixTree<ItemType>::freeNode(Node* node) {
+   switch(node->kind) {
+   case NODE4:
+      delete static_cast<Node4*>(node);
+      break;
+   case NODE16:
+      delete static_cast<Node16*>(node);
+      break;
+   case NODE48:
+      delete static_cast<Node48*>(node);
+      break;
+   default:
+      delete static_cast<Node256*>(node);
+      break;
+   }
+}
+
+//-------------------------------- resize -------------------------------------
+// Description:
+// moves the prefix, item and children of node into a new node of the given
+// layout and frees node
+// Preconditions:   the children fit in the new layout
+// Postconditions:  returns the new node
+template <typename ItemType>
+typename RadixTree<ItemType>::Node*
+RadixTree<ItemType>::resize(Node* node, int kind) {
+   Node* bigger = newNode(kind);
+   bigger->prefix.swap(node->prefix);
+   bigger->data = node->data;
+   int byte = -1;
+   Node* child;
+   while(nextChild(node, byte + 1, byte, child)) {
+      addChild(bigger, static_cast<unsigned char>(byte), child);
+   }
+   freeNode(node);
+   return bigger;
+}
+
+//------------------------------- childArray ----------------------------------
+// Description:
+// the array of child pointers of node and how many entries to look at; for
+// NODE256 that is all 256 and some are null, the others are dense
+template <typename ItemType>
+typename RadixTree<ItemType>::Node**
+RadixTree<ItemType>::childArray(Node* node, int& size) {
+   switch(node->kind) {
+   case NODE4:
+      size = node->count;
+      return static_cast<Node4*>(node)->children;
+   case NODE16:
+      size = node->count;
+      return static_cast<Node16*>(node)->children;
+   case NODE48:
+      size = node->count;
+      return static_cast<Node48*>(node)->children;
+   default:
+      size = 256;
+      return static_cast<Node256*>(node)->children;
+   }
+}
+
+//------------------------------- findChild -----------------------------------
+// Postconditions:  returns the slot holding the child for byte, or nullptr
+template <typename ItemType>
+typename RadixTree<ItemType>::Node**
+RadixTree<ItemType>::findChild(Node* node, unsigned char byte) {
+   switch(node->kind) {
+   case NODE4: {
+      Node4* small = static_cast<Node4*>(node);
+      for(int i = 0; i < node->count; i++) {
+         if(small->keys[i] == byte) {
+            return &small->children[i];
+         }
+      }
+      return nullptr;
+   }
+   case NODE16: {
+      Node16* small = static_cast<Node16*>(node);
+      for(int i = 0; i < node->count; i++) {
+         if(small->keys[i] == byte) {
+            return &small->children[i];
+         }
+      }
+      return nullptr;
+   }
+   case NODE48: {
+      Node48* node48 = static_cast<Node48*>(node);
+      int slot = node48->index[byte];
+      return (slot == 0) ? nullptr : &node48->children[slot - 1];
+   }
+   default: {
+      Node256* node256 = static_cast<Node256*>(node);
+      return (node256->children[byte] == nullptr) ? nullptr
+                                                  : &node256->children[byte];
+   }
+   }
+}
+
+//------------------------------- nextChild -----------------------------------
+// Description:
+// finds the child with the smallest byte >= from
+// Postconditions:  returns true and sets byte and child if there is one
+template <typename ItemType>
+bool RadixTree<ItemType>::nextChild(const Node* node, int from, int& byte,
+                                    Node*& child) {
+   switch(node->kind) {
+   case NODE4:
+   case NODE16: {
+      const unsigned char* keys;
+      Node* const* children;
+      if(node->kind == NODE4) {
+         keys = static_cast<const Node4*>(node)->keys;
+         children = static_cast<const Node4*>(node)->children;
+      }
+      else {
+         keys = static_cast<const Node16*>(node)->keys;
+         children = static_cast<const Node16*>(node)->children;
+      }
+      for(int i = 0; i < node->count; i++) {
+         if(keys[i] >= from) {
+            byte = keys[i];
+            child = children[i];
+            return true;
+         }
+      }
+      return false;
+   }
+   case NODE48: {
+      const Node48* node48 = static_cast<const Node48*>(node);
+      for(int b = from; b < 256; b++) {
+         if(node48->index[b] != 0) {
+            byte = b;
+            child = node48->children[node48->index[b] - 1];
+            return true;
+         }
+      }
+      return false;
+   }
+   default: {
+      const Node256* node256 = static_cast<const Node256*>(node);
+      for(int b = from; b < 256; b++) {
+         if(node256->children[b] != nullptr) {
+            byte = b;
+            child = node256->children[b];
+            return true;
+         }
+      }
+      return false;
+   }
+   }
+}
+
+//-------------------------------- addChild -----------------------------------
+// Description:
+// adds child under byte, moving node to the next layout first if it is full
+// Preconditions:   node has no child for byte
+// Postconditions:  node may point to a new node
+template <typename ItemType>
+void RadixTree<ItemType>::addChild(Node*& node, unsigned char byte,
+                                   Node* child) {
+   if((node->kind == NODE4 && node->count == 4) ||
+      (node->kind == NODE16 && node->count == 16) ||
+      (node->kind == NODE48 && node->count == 48)) {
+      node = resize(node, node->kind + 1);
+   }
+   switch(node->kind) {
+   case NODE4:
+   case NODE16: {
+      unsigned char* keys;
+      Node** children;
+      if(node->kind == NODE4) {
+         keys = static_cast<Node4*>(node)->keys;
+         children = static_cast<Node4*>(node)->children;
+      }
+      else {
+         keys = static_cast<Node16*>(node)->keys;
+         children = static_cast<Node16*>(node)->children;
+      }
+      int i = node->count;
+      while(i > 0 && keys[i - 1] > byte) {
+         keys[i] = keys[i - 1];
+         children[i] = children[i - 1];
+         i--;
+      }
+      keys[i] = byte;
+      children[i] = child;
+      break;
+   }
+   case NODE48: {
+      Node48* node48 = static_cast<Node48*>(node);
+      node48->children[node->count] = child;
+      node48->index[byte] = static_cast<unsigned char>(node->count + 1);
+      break;
+   }
+   default:
+      static_cast<Node256*>(node)->children[byte] = child;
+      break;
+   }
+   node->count++;
+}
+
+//------------------------------- removeChild ---------------------------------
+// Description:
+// removes the child under byte, moving node to the previous layout once it
+// has few enough children
+// Preconditions:   node has a child for byte
+// Postconditions:  node may point to a new node
+template <typename ItemType>
+void RadixTree<ItemType>::removeChild(Node*& node, unsigned char byte) {
+   switch(node->kind) {
+   case NODE4:
+   case NODE16: {
+      unsigned char* keys;
+      Node** children;
+      if(node->kind == NODE4) {
+         keys = static_cast<Node4*>(node)->keys;
+         children = static_cast<Node4*>(node)->children;
+      }
+      else {
+         keys = static_cast<Node16*>(node)->keys;
+         children = static_cast<Node16*>(node)->children;
+      }
+      int i = 0;
+      while(keys[i] != byte) {
+         i++;
+      }
+      for(; i < node->count - 1; i++) {
+         keys[i] = keys[i + 1];
+         children[i] = children[i + 1];
+      }
+      break;
+   }
+   case NODE48: {
+      // the last slot moves into the freed one to keep the slots dense
+      Node48* node48 = static_cast<Node48*>(node);
+      int slot = node48->index[byte] - 1;
+      int last = node->count - 1;
+      node48->index[byte] = 0;
+      if(slot != last) {
+         node48->children[slot] = node48->children[last];
+         for(int b = 0; b < 256; b++) {
+            if(node48->index[b] == last + 1) {
+               node48->index[b] = static_cast<unsigned char>(slot + 1);
+               break;
+            }
+         }
+      }
+      break;
+   }
+   default:
+      static_cast<Node256*>(node)->children[byte] = nullptr;
+      break;
+   }
+   node->count--;
+
+   if((node->kind == NODE16 && node->count <= 3) ||
+      (node->kind == NODE48 && node->count <= 12) ||
+      (node->kind == NODE256 && node->count <= 37)) {
+      node = resize(node, node->kind - 1);
+   }
+}
+
+//------------------------------- matchPrefix ---------------------------------
+template <typename ItemType>
+size_t RadixTree<ItemType>::matchPrefix(const Node* current,
+                                        const string& key, size_t depth) {
+   size_t limit = min(current->prefix.size(), key.size() - depth);
+   size_t i = 0;
+   while(i < limit && current->prefix[i] == key[depth + i]) {
+      i++;
+   }
+   return i;
+}
+
+//--------------------------------- newLeaf -----------------------------------
+template <typename ItemType>
+typename RadixTree<ItemType>::Node*
+RadixTree<ItemType>::newLeaf(const string& key, size_t depth,
+                             ItemType* data) {
+   Node* leaf = newNode(NODE4);
+   leaf->prefix.assign(key, depth, string::npos);
+   leaf->data = data;
+   return leaf;
+}
+
+// ------------------------------ insert -------------------------------------
+// Description:
+// follows the key down the tree; where the key leaves a node's prefix the
+// node is split in two, where it runs out of children a leaf is added
+// Preconditions:   ItemType newData has been allocated
+// Postconditions:  return true and the tree owns newData if inserted
+//                  return false if the key is a duplicate
+template <typename ItemType>
+bool RadixTree<ItemType>::insert(ItemType* newData) {
+   const string& key = newData->key();
+   Node** current = &root;
+   size_t depth = 0;
+   while(*current != nullptr) {
+      Node* node = *current;
+      size_t matched = matchPrefix(node, key, depth);
+      if(matched < node->prefix.size()) {
+         // split: a new node takes the matched part of the prefix
+         Node* parent = newNode(NODE4);
+         parent->prefix.assign(node->prefix, 0, matched);
+         unsigned char byte = node->prefix[matched];
+         node->prefix.erase(0, matched + 1);
+         addChild(parent, byte, node);
+         depth += matched;
+         if(depth == key.size()) {
+            parent->data = newData;
+         }
+         else {
+            addChild(parent, key[depth], newLeaf(key, depth + 1, newData));
+         }
+         *current = parent;
+         itemCount++;
+         return true;
+      }
+      depth += matched;
+      if(depth == key.size()) {
+         if(node->data != nullptr) {
+            return false;
+         }
+         node->data = newData;
+         itemCount++;
+         return true;
+      }
+      Node** child = findChild(node, key[depth]);
+      if(child == nullptr) {
+         addChild(*current, key[depth], newLeaf(key, depth + 1, newData));
+         itemCount++;
+         return true;
+      }
+      current = child;
+      depth++;
+   }
+   *current = newLeaf(key, depth, newData);
+   itemCount++;
+   return true;
+}
+
+//------------------------------- retrieve -----------------------------------
+// Postconditions:  return true if an item with the target's key was found
+//                  and p is pointing to it, return false otherwise
+template <typename ItemType>
+bool RadixTree<ItemType>::retrieve(const ItemType& target,
+                                   ItemType*& p) const {
+   const string& key = target.key();
+   Node* current = root;
+   size_t depth = 0;
+   while(current != nullptr) {
+      if(matchPrefix(current, key, depth) != current->prefix.size()) {
+         return false;
+      }
+      depth += current->prefix.size();
+      if(depth == key.size()) {
+         if(current->data == nullptr) {
+            return false;
+         }
+         p = current->data;
+         return true;
+      }
+      Node** child = findChild(current, key[depth]);
+      if(child == nullptr) {
+         return false;
+      }
+      current = *child;
+      depth++;
+   }
+   return false;
+}
+
+//---------------------------------- erase ------------------------------------
+// Postconditions: return true if an item with the target's key was found
+//                 and deleted, return false otherwise
+template <typename ItemType>
+bool RadixTree<ItemType>::erase(const ItemType& target) {
+   if(eraseHelper(root, target.key(), 0)) {
+      itemCount--;
+      return true;
+   }
+   return false;
+}
+
+//------------------------------- eraseHelper ---------------------------------
+// Description:
+// deletes the item, then on the way back up drops nodes left with neither
+// item nor children and merges nodes left with only one child
+template <typename ItemType>
+bool RadixTree<ItemType>::eraseHelper(Node*& current, const string& key,
+                                      size_t depth) {
+   if(current == nullptr ||
+      matchPrefix(current, key, depth) != current->prefix.size()) {
+      return false;
+   }
+   depth += current->prefix.size();
+   if(depth == key.size()) {
+      if(current->data == nullptr) {
+         return false;
+      }
+      delete current->data;
+      current->data = nullptr;
+   }
+   else {
+      unsigned char byte = key[depth];
+      Node** child = findChild(current, byte);
+      if(child == nullptr || !eraseHelper(*child, key, depth + 1)) {
+         return false;
+      }
+      if(*child == nullptr) {
+         removeChild(current, byte);
+      }
+   }
+   compact(current);
+   return true;
+}
+
+//--------------------------------- compact -----------------------------------
+// Description:
+// a node without an item is deleted if it has no children, and merged into
+// its child if it has one, by prepending its prefix and branch byte
+template <typename ItemType>
+void RadixTree<ItemType>::compact(Node*& current) {
+   if(current->data != nullptr || current->count > 1) {
+      return;
+   }
+   Node* node = current;
+   if(node->count == 0) {
+      current = nullptr;
+   }
+   else {
+      int byte;
+      Node* child;
+      nextChild(node, 0, byte, child);
+      node->prefix += static_cast<char>(byte);
+      child->prefix.insert(0, node->prefix);
+      current = child;
+   }
+   freeNode(node);
+}
+
+//---------------------------- forEachWithPrefix ------------------------------
+// Description:
+// follows prefix down the tree to the subtree holding every key that starts
+// with it, which may end part way through a node's prefix, then walks that
+// subtree in order
+template <typename ItemType>
+template <typename Function>
+void RadixTree<ItemType>::forEachWithPrefix(const string& prefix,
+                                            Function fn) const {
+   const Node* current = root;
+   size_t depth = 0;
+   while(current != nullptr) {
+      size_t matched = matchPrefix(current, prefix, depth);
+      if(depth + matched == prefix.size()) {
+         walkHelper(current, fn);
+         return;
+      }
+      if(matched < current->prefix.size()) {
+         return;
+      }
+      depth += matched;
+      Node** child = findChild(const_cast<Node*>(current), prefix[depth]);
+      if(child == nullptr) {
+         return;
+      }
+      current = *child;
+      depth++;
+   }
+}
+
+//------------------------------- walkHelper ----------------------------------
+// Description:
+// preorder walk, a node's own item sorts before everything below it
+template <typename ItemType>
+template <typename Function>
+void RadixTree<ItemType>::walkHelper(const Node* current, Function& fn) {
+   if(current->data != nullptr) {
+      fn(static_cast<const ItemType&>(*current->data));
+   }
+   int byte = -1;
+   Node* child;
+   while(nextChild(current, byte + 1, byte, child)) {
+      walkHelper(child, fn);
+   }
+}
+
+//--------------------------------- begin -------------------------------------
+// Postconditions:  returns an iterator to the smallest item
+template <typename ItemType>
+typename RadixTree<ItemType>::const_iterator
+RadixTree<ItemType>::begin() const {
+   const_iterator it;
+   if(root != nullptr) {
+      typename const_iterator::Frame frame = { root, 0 };
+      it.path.push_back(frame);
+      if(root->data == nullptr) {
+         ++it;
+      }
+   }
+   return it;
+}
+
+//---------------------------------- end --------------------------------------
+template <typename ItemType>
+typename RadixTree<ItemType>::const_iterator
+RadixTree<ItemType>::end() const {
+   return const_iterator();
+}
+
+//----------------------------- operator++ ------------------------------------
+// Description:
+// descends into the next unvisited child of the deepest node that has one,
+// stopping at the first node that holds an item
+template <typename ItemType>
+typename RadixTree<ItemType>::const_iterator&
+RadixTree<ItemType>::const_iterator::operator++() {
+   while(!path.empty()) {
+      Frame& top = path.back();
+      int byte;
+      Node* child;
+      if(top.next < 256 && nextChild(top.node, top.next, byte, child)) {
+         top.next = byte + 1;
+         Frame frame = { child, 0 };
+         path.push_back(frame);
+         if(child->data != nullptr) {
+            return *this;
+         }
+      }
+      else {
+         path.pop_back();
+      }
+   }
+   return *this;
+}
+
+#endif
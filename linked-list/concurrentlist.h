@@ -0,0 +1,490 @@
+////////////////////////////////  concurrentlist.h file  //////////////////////
+// Lock-free sorted linked list that many threads can use at once
+
+#ifndef CONCURRENTLIST_H
+#define CONCURRENTLIST_H
+
+#include <iostream>
+#include <fstream>
+#include <atomic>
+#include <vector>
+#include <thread>
+#include <cstdint>
+using namespace std;
+
+//--------------------------  class ConcurrentList  --------------------------
+// ADT ConcurrentList: Finite, ordered collection of zero or more items.
+//           The ordering is determined by operator< of T class.
+//           Ability to insert, retrieve and remove data from many threads
+//           at the same time without locks
+//
+// Assumptions and Implementation:
+//   -- Control of <, ==, printing, etc. of T information is in the T class.
+//   -- Harris-Michael list:
+//    - A node is removed in two steps. First the low bit of its next link
+//      is set (marked), which stops any insert after it, then the link
+//      before it is swung past it with a compare and swap.
+//    - Any thread that walks into a marked node unlinks it before going
+//      on, so a remover that is slowed down never blocks the others.
+//    - insert and remove retry only when another thread changed the same
+//      link, some thread always makes progress.
+//   -- Retrieve Function:
+//    - Only reads links and never retries, the walk ends after at most
+//      the number of nodes in the list, it is wait-free once the calling
+//      thread is registered (see Reclamation).
+//    - Copies the item out, so the caller never holds a pointer into a
+//      node another thread may remove.
+//   -- Reclamation:
+//    - Epoch based. An operation pins its thread's record with the global
+//      epoch, unlinked nodes are retired with the epoch they were unlinked
+//      in and freed once the global epoch is two past it. The epoch only
+//      moves ahead when every pinned record has seen the current one, so
+//      no thread can still be reading a freed node.
+//    - Each thread has its own record, pushed onto the list's records the
+//      first time the thread uses the list and found again through a
+//      thread_local cache, so pinning only writes the thread's own record
+//      and never waits for other threads. Records stay until the list is
+//      destroyed; a later thread with the id of one that ended takes over
+//      its record.
+//   -- Insert Function:
+//    - Allocates memory for a Node, ptr to the data is passed in and the
+//      list owns it from then on.
+//    - Duplicate data is allowed, a new item goes before equal items.
+//   -- Remove Function:
+//    - Returns a new copy of the item for the caller to reclaim; the
+//      list's own copy is freed with its node.
+//   -- size, isEmpty and operator<< see a moment of a list that may be
+//      changing, they are exact only when no other thread is using it.
+//   -- The destructor must not run while another thread uses the list.
+//----------------------------------------------------------------------------
+
+template <typename T>
+class ConcurrentList {
+
+   // output operator for class ConcurrentList, print data,
+   // responsibility for output is left to object stored in the list
+   friend ostream& operator<<(ostream& output,
+                              const ConcurrentList<T>& thelist) {
+      typename ConcurrentList<T>::Record* rec = thelist.pin();
+      typename ConcurrentList<T>::Node* current =
+                                 thelist.pointer(thelist.head.load());
+      while (current != nullptr) {
+         uintptr_t next = current->next.load();
+         if (!thelist.isMarked(next)) {
+            output << *current->data;
+         }
+         current = thelist.pointer(next);
+      }
+      thelist.unpin(rec);
+      return output;
+   }
+
+public:
+   ConcurrentList();                          // default constructor
+   ~ConcurrentList();                         // destructor
+   ConcurrentList(const ConcurrentList<T>&) = delete;
+   const ConcurrentList<T>& operator=(const ConcurrentList<T>&) = delete;
+
+   void buildList(ifstream&);            // build a list from datafile
+
+   bool insert(T*);                      // insert one item, list owns it
+   bool retrieve(const T&, T&) const;    // copies the first equal item
+   bool remove(const T&, T*&);           // removes the first equal item
+   bool isEmpty() const;                 // is list empty?
+   int size() const;                     // number of items in the list
+   void makeEmpty();                     // removes every item
+
+private:
+   static const int RECLAIM_BATCH = 64;  // retired nodes before freeing
+
+   struct Node {                 // the node in a linked list
+      T* data;                   // pointer to actual data, operations in T
+      atomic<uintptr_t> next;    // next node, low bit set when removed
+   };
+
+   struct Retired {              // a node waiting to be freed
+      Node* node;
+      unsigned long epoch;       // global epoch when it was unlinked
+   };
+
+   struct Record {               // one thread using the list
+      atomic<bool> pinned;       // the thread is in an operation
+      atomic<unsigned long> epoch;  // global epoch when it was pinned
+      vector<Retired> retired;   // only used by the owning thread
+      thread::id owner;          // thread the record belongs to
+      Record* next;              // next record of the list
+      char pad[64];              // keeps records on separate cache lines
+   };
+
+   atomic<uintptr_t> head;       // first node, never marked
+   atomic<int> count;            // number of items in the list
+   mutable atomic<unsigned long> globalEpoch;
+   mutable atomic<Record*> records;  // one per thread that used the list
+   const unsigned long id;       // tells lists apart in thread caches
+   static atomic<unsigned long> nextId;
+
+   static Node* pointer(uintptr_t);
+   static bool isMarked(uintptr_t);
+
+   // first unmarked node not less than target and the link to it,
+   // unlinking the marked nodes on the way
+   void find(const T&, atomic<uintptr_t>*&, Node*&, Record*) const;
+
+   Record* record() const;               // the calling thread's record
+   Record* pin() const;                  // starts an operation
+   void unpin(Record*) const;            // ends it
+   void retire(Node*, Record*) const;    // frees node once no one sees it
+   bool tryAdvance() const;              // moves the global epoch ahead
+   static void freeNode(Node*);
+};
+
+
+template <typename T>
+atomic<unsigned long> ConcurrentList<T>::nextId(1);
+
+//----------------------------------------------------------------------------
+// Constructor
+// an empty list, no thread has used it yet
+template <typename T>
+ConcurrentList<T>::ConcurrentList()
+   : head(0), count(0), globalEpoch(0), records(nullptr), id(nextId++) {
+}
+
+//----------------------------------------------------------------------------
+// Destructor
+// frees every node still in the list or waiting in a record, and the
+// records
+template <typename T>
+ConcurrentList<T>::~ConcurrentList() {
+   Node* current = pointer(head.load());
+   while(current != nullptr) {
+      Node* next = pointer(current->next.load());
+      freeNode(current);
+      current = next;
+   }
+   Record* rec = records.load();
+   while(rec != nullptr) {
+      for(const Retired& item : rec->retired) {
+         freeNode(item.node);
+      }
+      Record* next = rec->next;
+      delete rec;
+      rec = next;
+   }
+}
+
+//----------------------------------------------------------------------------
+// freeNode
+// reclaims the memory of a node and of its data
+template <typename T>
+void ConcurrentList<T>::freeNode(Node* node) {
+   delete node->data;
+   delete node;
+}
+
+//----------------------------------------------------------------------------
+// pointer
+// the node a link points to, without the mark bit
+template <typename T>
+typename ConcurrentList<T>::Node* ConcurrentList<T>::pointer(uintptr_t link) {
+   return reinterpret_cast<Node*>(link & ~static_cast<uintptr_t>(1));
+}
+
+//----------------------------------------------------------------------------
+// isMarked
+// whether the node holding this link has been removed
+template <typename T>
+bool ConcurrentList<T>::isMarked(uintptr_t link) {
+   return (link & 1) != 0;
+}
+
+//----------------------------------------------------------------------------
+// record
+// the calling thread's record for this list: the one it used last time,
+// kept in a thread_local cache, else the record with its thread id, else a
+// new record pushed onto records. Only the push can retry, once per thread.
+template <typename T>
+typename ConcurrentList<T>::Record* ConcurrentList<T>::record() const {
+   static thread_local unsigned long cachedId = 0;
+   static thread_local Record* cached = nullptr;
+   if(cachedId == id) {
+      return cached;
+   }
+   thread::id self = this_thread::get_id();
+   Record* rec = records.load(memory_order_acquire);
+   while(rec != nullptr && rec->owner != self) {
+      rec = rec->next;
+   }
+   if(rec == nullptr) {
+      rec = new Record;
+      rec->pinned.store(false);
+      rec->epoch.store(0);
+      rec->owner = self;
+      rec->next = records.load();
+      while(!records.compare_exchange_weak(rec->next, rec)) {
+      }
+   }
+   cachedId = id;
+   cached = rec;
+   return rec;
+}
+
+//----------------------------------------------------------------------------
+// pin
+// marks the thread's record as in an operation at the global epoch
+template <typename T>
+typename ConcurrentList<T>::Record* ConcurrentList<T>::pin() const {
+   Record* rec = record();
+   rec->epoch.store(globalEpoch.load());
+   rec->pinned.store(true);
+   atomic_thread_fence(memory_order_seq_cst);
+   return rec;
+}
+
+//----------------------------------------------------------------------------
+// unpin
+// the operation is done reading nodes
+template <typename T>
+void ConcurrentList<T>::unpin(Record* rec) const {
+   rec->pinned.store(false, memory_order_release);
+}
+
+//----------------------------------------------------------------------------
+// tryAdvance
+// the global epoch moves ahead only if every pinned record has seen it
+template <typename T>
+bool ConcurrentList<T>::tryAdvance() const {
+   atomic_thread_fence(memory_order_seq_cst);
+   unsigned long current = globalEpoch.load();
+   for(Record* rec = records.load(); rec != nullptr; rec = rec->next) {
+      if(rec->pinned.load() && rec->epoch.load() != current) {
+         return false;
+      }
+   }
+   return globalEpoch.compare_exchange_strong(current, current + 1);
+}
+
+//----------------------------------------------------------------------------
+// retire
+// an unlinked node waits in the thread's record; every RECLAIM_BATCH nodes
+// the epoch is pushed ahead and nodes retired two or more epochs ago are
+// freed
+template <typename T>
+void ConcurrentList<T>::retire(Node* node, Record* rec) const {
+   Retired item = { node, globalEpoch.load() };
+   rec->retired.push_back(item);
+   if(rec->retired.size() < RECLAIM_BATCH) {
+      return;
+   }
+   tryAdvance();
+   unsigned long current = globalEpoch.load();
+   size_t kept = 0;
+   for(size_t i = 0; i < rec->retired.size(); i++) {
+      if(rec->retired[i].epoch + 2 <= current) {
+         freeNode(rec->retired[i].node);
+      }
+      else {
+         rec->retired[kept++] = rec->retired[i];
+      }
+   }
+   rec->retired.resize(kept);
+}
+
+//----------------------------------------------------------------------------
+// find
+// walks from head to the first unmarked node not less than target; link
+// is left at the link that points to it, which belongs to an unmarked
+// node or is head. A marked node on the way is unlinked; if another
+// thread changed the link first, the walk starts over from head.
+template <typename T>
+void ConcurrentList<T>::find(const T& target, atomic<uintptr_t>*& link,
+                             Node*& current, Record* rec) const {
+   atomic<uintptr_t>* start = const_cast<atomic<uintptr_t>*>(&head);
+retry:
+   link = start;
+   current = pointer(link->load(memory_order_acquire));
+   while(current != nullptr) {
+      uintptr_t next = current->next.load(memory_order_acquire);
+      if(isMarked(next)) {
+         uintptr_t expected = reinterpret_cast<uintptr_t>(current);
+         if(!link->compare_exchange_strong(expected, next & ~uintptr_t(1))) {
+            goto retry;
+         }
+         retire(current, rec);
+         current = pointer(next);
+         continue;
+      }
+      if(!(*current->data < target)) {
+         return;
+      }
+      link = &current->next;
+      current = pointer(next);
+   }
+}
+
+//----------------------------------------------------------------------------
+// insert
+// links a new node in front of the first item not less than it; retries
+// if the link changed between find and the compare and swap
+template <typename T>
+bool ConcurrentList<T>::insert(T* dataptr) {
+   Node* ptr = new Node;
+   ptr->data = dataptr;
+
+   Record* rec = pin();
+   for(;;) {
+      atomic<uintptr_t>* link;
+      Node* current;
+      find(*dataptr, link, current, rec);
+      uintptr_t expected = reinterpret_cast<uintptr_t>(current);
+      ptr->next.store(expected, memory_order_relaxed);
+      if(link->compare_exchange_strong(expected,
+                                       reinterpret_cast<uintptr_t>(ptr))) {
+         break;
+      }
+   }
+   unpin(rec);
+   count++;
+   return true;
+}
+
+//----------------------------------------------------------------------------
+// remove
+// marks the first item equal to target, then unlinks it; the thread that
+// marks it is the one that removed it
+template <typename T>
+bool ConcurrentList<T>::remove(const T& target, T*& p) {
+   Record* rec = pin();
+   for(;;) {
+      atomic<uintptr_t>* link;
+      Node* current;
+      find(target, link, current, rec);
+      if(current == nullptr || !(*current->data == target)) {
+         unpin(rec);
+         return false;
+      }
+      uintptr_t next = current->next.load();
+      if(isMarked(next) ||
+         !current->next.compare_exchange_strong(next, next | 1)) {
+         continue;                       // removed or changed, look again
+      }
+      p = new T(*current->data);
+      count--;
+
+      // unlink it now, or leave it for the next find to unlink
+      uintptr_t expected = reinterpret_cast<uintptr_t>(current);
+      if(link->compare_exchange_strong(expected, next)) {
+         retire(current, rec);
+      }
+      else {
+         find(target, link, current, rec);
+      }
+      unpin(rec);
+      return true;
+   }
+}
+
+//----------------------------------------------------------------------------
+// retrieve
+// walks past smaller items and skips removed ones without changing any
+// link, found gets a copy of the first equal item
+template <typename T>
+bool ConcurrentList<T>::retrieve(const T& target, T& found) const {
+   Record* rec = pin();
+   bool success = false;
+   Node* current = pointer(head.load(memory_order_acquire));
+   while(current != nullptr && *current->data < target) {
+      current = pointer(current->next.load(memory_order_acquire));
+   }
+   while(current != nullptr && *current->data == target) {
+      uintptr_t next = current->next.load(memory_order_acquire);
+      if(!isMarked(next)) {
+         found = *current->data;
+         success = true;
+         break;
+      }
+      current = pointer(next);
+   }
+   unpin(rec);
+   return success;
+}
+
+//----------------------------------------------------------------------------
+// isEmpty
+// whether there is no unmarked node
+template <typename T>
+bool ConcurrentList<T>::isEmpty() const {
+   Record* rec = pin();
+   Node* current = pointer(head.load(memory_order_acquire));
+   while(current != nullptr &&
+         isMarked(current->next.load(memory_order_acquire))) {
+      current = pointer(current->next.load(memory_order_acquire));
+   }
+   unpin(rec);
+   return current == nullptr;
+}
+
+//----------------------------------------------------------------------------
+// size
+template <typename T>
+int ConcurrentList<T>::size() const {
+   return count.load();
+}
+
+//----------------------------------------------------------------------------
+// makeEmpty
+// marks and unlinks the first node until none is left, items inserted by
+// other threads meanwhile may be removed too
+template <typename T>
+void ConcurrentList<T>::makeEmpty() {
+   Record* rec = pin();
+   for(;;) {
+      Node* current = pointer(head.load(memory_order_acquire));
+      if(current == nullptr) {
+         break;
+      }
+      uintptr_t next = current->next.load();
+      if(!isMarked(next)) {
+         if(!current->next.compare_exchange_strong(next, next | 1)) {
+            continue;
+         }
+         count--;
+      }
+      uintptr_t expected = reinterpret_cast<uintptr_t>(current);
+      if(head.compare_exchange_strong(expected, next & ~uintptr_t(1))) {
+         retire(current, rec);
+      }
+   }
+   unpin(rec);
+}
+
+//----------------------------------------------------------------------------
+// buildList
+// continually insert new items into the list
+template <typename T>
+void ConcurrentList<T>::buildList(ifstream& infile) {
+   T* ptr;
+   bool successfulRead;                            // read good data
+   bool success = false;                           // successfully insert
+   for (;;) {
+      ptr = new T;
+      successfulRead = ptr->setData(infile);       // fill the T object
+      if (infile.eof()) {                          // reaches end of file
+         delete ptr;
+         ptr = nullptr;
+         break;
+      }
+
+      // insert good data into the list, otherwise ignore it
+      if (successfulRead) {
+         success = insert(ptr);
+      }
+      else {
+         delete ptr;
+         ptr = nullptr;
+      }
+      if (!success) break;
+   }
+}
+
+#endif
@@ -0,0 +1,488 @@
+////////////////////////////////  intrusivelist.h file  ///////////////////////
+// Sorted linked list whose items carry their own link, no Node allocation
+
+#ifndef INTRUSIVELIST_H
+#define INTRUSIVELIST_H
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <algorithm>
+using namespace std;
+
+//--------------------------  struct ListHook  -------------------------------
+// ListHook: the link an item needs to be in an IntrusiveList. An item type
+//           derives from it publicly, e.g. class Employee :
+//           public ListHook<Employee>. Copying an item does not copy its
+//           link, so a copy starts out in no list.
+//----------------------------------------------------------------------------
+
+template <typename T>
+struct ListHook {
+   ListHook() : next(nullptr) {}
+   ListHook(const ListHook<T>&) : next(nullptr) {}
+   ListHook<T>& operator=(const ListHook<T>&) { return *this; }
+
+   T* next;                      // next item in the list it is in
+};
+
+//--------------------------  class IntrusiveList  ---------------------------
+// ADT IntrusiveList: Finite, ordered collection of zero or more items.
+//           The ordering is determined by operator< of T class.
+//           Ability to find union of two lists
+//           Ability to find intersection of two lists
+//           Ability to retrieve data from a list
+//           Ability to remove data from a list
+//
+// Assumptions and Implementation:
+//   -- Control of <, printing, etc. of T information is in the T class.
+//   -- T derives from ListHook<T>, the list links items through it. An item
+//      is in at most one list at a time.
+//   -- Compared with List, there is no Node: each item is one allocation
+//      instead of two, and walking the list reads the item and its link
+//      from the same object.
+//   -- Head:
+//    - head points to the first item, nullptr if the list is empty.
+//    - tail points to the last item and count is the number of items.
+//   -- Insert Function:
+//    - The list takes over the item, the caller allocates it with new.
+//    - No memory is allocated.
+//    - Duplicate data is allowed, a new item goes before equal items.
+//    - An item greater than the last one is linked after tail without
+//      walking the list.
+//   -- Remove Function:
+//    - Unlinks the item and gives it back to the caller to reclaim.
+//   -- Intersect Function:
+//    - At termination of the function, the two parameter lists are unchanged
+//      unless one is also the current object.
+//    - New memory is allocated if there is an intersection, each common
+//      item is copied.
+//   -- Merge Function:
+//    - At termination of function, the two parameter lists are empty unless
+//      one is also the current object
+//    - Duplicate data is allowed, equal items of firstList go first.
+//    - No new memory is allocated.
+//   -- BuildList:
+//    - Reads every record, sorts them once and links them in one pass
+//      merged with the items already there, as List does.
+//----------------------------------------------------------------------------
+
+template <typename T>
+class IntrusiveList {
+
+   // output operator for class IntrusiveList, print data,
+   // responsibility for output is left to object stored in the list
+   friend ostream& operator<<(ostream& output,
+                              const IntrusiveList<T>& thelist) {
+      for (const T* current = thelist.head; current != nullptr;
+                                            current = nextOf(current)) {
+         output << *current;
+      }
+      return output;
+   }
+
+public:
+   IntrusiveList();                            // default constructor
+   ~IntrusiveList();                           // destructor
+   IntrusiveList(const IntrusiveList<T>&);     // copy constructor
+
+   // operator overloads
+   const IntrusiveList<T>& operator=(const IntrusiveList<T>&);
+   bool operator==(const IntrusiveList<T>&) const;
+   bool operator!=(const IntrusiveList<T>&) const;
+
+   void buildList(ifstream&);            // build a list from datafile
+
+   void merge(IntrusiveList<T>&, IntrusiveList<T>&);
+   void intersect(const IntrusiveList<T>&, const IntrusiveList<T>&);
+
+   bool insert(T*);                      // insert one item into list
+   bool pushBack(T*);                    // append one item, O(1) if in order
+   bool isEmpty() const;                 // is list empty?
+   int size() const;                     // number of items in the list
+   bool retrieve(const T&, T*&) const;   // retrieves an item from the list
+   bool remove(const T&, T*&);           // removes an item from the list
+   void makeEmpty();                     // deletes the current list
+
+private:
+   T* head;                      // first item in list
+   T* tail;                      // last item in list
+   int count;                    // number of items in list
+
+   // the link of an item, through its ListHook
+   static T*& nextOf(T*);
+   static const T* nextOf(const T*);
+   static bool lessItem(const T*, const T*);
+
+   void copy(const IntrusiveList<T>&);   // copies a list into an empty list
+   void append(T*);                      // links an item after tail
+};
+
+
+//----------------------------------------------------------------------------
+// nextOf
+// the link stored in the item's ListHook
+template <typename T>
+T*& IntrusiveList<T>::nextOf(T* item) {
+   return static_cast<ListHook<T>*>(item)->next;
+}
+
+template <typename T>
+const T* IntrusiveList<T>::nextOf(const T* item) {
+   return static_cast<const ListHook<T>*>(item)->next;
+}
+
+//----------------------------------------------------------------------------
+// lessItem
+// orders item pointers by operator< of the items
+template <typename T>
+bool IntrusiveList<T>::lessItem(const T* left, const T* right) {
+   return *left < *right;
+}
+
+//----------------------------------------------------------------------------
+// Constructor
+template <typename T>
+IntrusiveList<T>::IntrusiveList() {
+   head = nullptr;
+   tail = nullptr;
+   count = 0;
+}
+
+//----------------------------------------------------------------------------
+// Copy Constructor
+// copies a list into the current list
+template <typename T>
+IntrusiveList<T>::IntrusiveList(const IntrusiveList<T>& right) {
+   head = nullptr;
+   tail = nullptr;
+   count = 0;
+   copy(right);
+}
+
+//----------------------------------------------------------------------------
+// Destructor
+// empties a list
+template <typename T>
+IntrusiveList<T>::~IntrusiveList() {
+   makeEmpty();
+}
+
+//----------------------------------------------------------------------------
+// operator=
+// copies a list into the current list
+template <typename T>
+const IntrusiveList<T>& IntrusiveList<T>::operator=(
+                                          const IntrusiveList<T>& right) {
+   if(this != &right) {          // if current list is same as argument
+      makeEmpty();
+      copy(right);
+   }
+   return *this;
+}
+
+//----------------------------------------------------------------------------
+// append
+// links item after the last item
+template <typename T>
+void IntrusiveList<T>::append(T* item) {
+   nextOf(item) = nullptr;
+   if(tail == nullptr) {
+      head = item;
+   }
+   else {
+      nextOf(tail) = item;
+   }
+   tail = item;
+   count++;
+}
+
+//----------------------------------------------------------------------------
+// copy
+// copies every item of right in order, the copies start with no link
+template <typename T>
+void IntrusiveList<T>::copy(const IntrusiveList<T>& right) {
+   for(const T* current = right.head; current != nullptr;
+                                      current = nextOf(current)) {
+      append(new T(*current));
+   }
+}
+
+//----------------------------------------------------------------------------
+// makeEmpty
+// deletes every item
+template <typename T>
+void IntrusiveList<T>::makeEmpty() {
+   T* current = head;
+   while(current != nullptr) {
+      T* next = nextOf(current);
+      delete current;
+      current = next;
+   }
+   head = nullptr;
+   tail = nullptr;
+   count = 0;
+}
+
+//----------------------------------------------------------------------------
+// isEmpty
+template <typename T>
+bool IntrusiveList<T>::isEmpty() const {
+   return head == nullptr;
+}
+
+//----------------------------------------------------------------------------
+// size
+template <typename T>
+int IntrusiveList<T>::size() const {
+   return count;
+}
+
+//----------------------------------------------------------------------------
+// insert
+// links the item before the first item not less than it
+template <typename T>
+bool IntrusiveList<T>::insert(T* item) {
+   // greater than the last item, link it at the end without walking
+   if(tail != nullptr && *tail < *item) {
+      append(item);
+      return true;
+   }
+
+   T** link = &head;                        // where the item goes
+   while(*link != nullptr && **link < *item) {
+      link = &nextOf(*link);
+   }
+   nextOf(item) = *link;
+   *link = item;
+   if(nextOf(item) == nullptr) {
+      tail = item;
+   }
+   count++;
+   return true;
+}
+
+//----------------------------------------------------------------------------
+// pushBack
+// appends an item that is not less than the last one, an item out of
+// order is inserted where it belongs
+template <typename T>
+bool IntrusiveList<T>::pushBack(T* item) {
+   if(tail != nullptr && *item < *tail) {
+      return insert(item);
+   }
+   append(item);
+   return true;
+}
+
+//----------------------------------------------------------------------------
+// buildList
+// reads every item of the file, sorts them and links them into the list
+// in one pass, each after the items that are not greater than it
+template <typename T>
+void IntrusiveList<T>::buildList(ifstream& infile) {
+   vector<T*> items;
+   for (;;) {
+      T* ptr = new T;
+      bool successfulRead = ptr->setData(infile);  // fill the T object
+      if (infile.eof()) {                          // reaches end of file
+         delete ptr;
+         break;
+      }
+
+      // keep good data, otherwise ignore it
+      if (successfulRead) {
+         items.push_back(ptr);
+      }
+      else {
+         delete ptr;
+      }
+   }
+   stable_sort(items.begin(), items.end(), lessItem);
+
+   T** link = &head;                        // where the next item goes
+   T* current = head;                       // first item not yet passed
+   for (T* item : items) {
+      while (current != nullptr && !(*item < *current)) {
+         link = &nextOf(current);
+         current = nextOf(current);
+      }
+      nextOf(item) = current;
+      *link = item;
+      link = &nextOf(item);
+      if (current == nullptr) {
+         tail = item;
+      }
+   }
+   count += items.size();
+}
+
+//----------------------------------------------------------------------------
+// operator==
+// finds if two lists hold equal items in the same order
+template <typename T>
+bool IntrusiveList<T>::operator==(const IntrusiveList<T>& right) const {
+   if(this == &right) {
+      return true;
+   }
+   if(count != right.count) {
+      return false;
+   }
+   const T* thisCurrent = head;
+   const T* rightCurrent = right.head;
+   while(thisCurrent != nullptr) {
+      if(*thisCurrent != *rightCurrent) {
+         return false;
+      }
+      thisCurrent = nextOf(thisCurrent);
+      rightCurrent = nextOf(rightCurrent);
+   }
+   return true;
+}
+
+//----------------------------------------------------------------------------
+// operator!=
+// utilizes definition of == to find if two lists are not equal
+template <typename T>
+bool IntrusiveList<T>::operator!=(const IntrusiveList<T>& right) const {
+   return !(*this == right);
+}
+
+//----------------------------------------------------------------------------
+// retrieve
+// finds the first item equal to target, the list is sorted so the walk
+// stops at the first greater item
+template <typename T>
+bool IntrusiveList<T>::retrieve(const T& target, T*& p) const {
+   T* current = head;
+   while(current != nullptr && *current < target) {
+      current = nextOf(current);
+   }
+   if(current != nullptr && *current == target) {
+      p = current;
+      return true;
+   }
+   return false;
+}
+
+//----------------------------------------------------------------------------
+// remove
+// unlinks the first item equal to target, p is set to it for the caller
+// to reclaim
+template <typename T>
+bool IntrusiveList<T>::remove(const T& target, T*& p) {
+   T** link = &head;
+   T* previous = nullptr;
+   while(*link != nullptr && **link < target) {
+      previous = *link;
+      link = &nextOf(previous);
+   }
+   if(*link == nullptr || !(**link == target)) {
+      return false;
+   }
+   p = *link;
+   *link = nextOf(p);
+   nextOf(p) = nullptr;
+   if(p == tail) {
+      tail = previous;
+   }
+   count--;
+   return true;
+}
+
+//----------------------------------------------------------------------------
+// merge
+// takes 2 sorted lists and merge into one long sorted list
+// At termination of function, the two parameter lists are empty unless one
+// is also the current object
+template <typename T>
+void IntrusiveList<T>::merge(IntrusiveList<T>& firstList,
+                             IntrusiveList<T>& secondList) {
+   // if the calling object is the same as the two arguments
+   // e.g. company1.merge(company1, company1);
+   if(this == &firstList && this == &secondList) {
+      return;
+   }
+
+   // take the items of both lists before emptying the current list, which
+   // may be one of them
+   bool same = &secondList == &firstList;
+   T* firstCurrent = firstList.head;
+   T* secondCurrent = same ? nullptr : secondList.head;
+   T* firstTail = firstList.tail;
+   T* secondTail = same ? nullptr : secondList.tail;
+   int total = firstList.count + (same ? 0 : secondList.count);
+   firstList.head = firstList.tail = nullptr;
+   firstList.count = 0;
+   secondList.head = secondList.tail = nullptr;
+   secondList.count = 0;
+   makeEmpty();
+
+   while(firstCurrent != nullptr && secondCurrent != nullptr) {
+      if(!(*secondCurrent < *firstCurrent)) {
+         T* next = nextOf(firstCurrent);
+         append(firstCurrent);
+         firstCurrent = next;
+      }
+      else {
+         T* next = nextOf(secondCurrent);
+         append(secondCurrent);
+         secondCurrent = next;
+      }
+   }
+
+   // the rest of the longer list is already linked
+   T* rest = (firstCurrent != nullptr) ? firstCurrent : secondCurrent;
+   if(rest != nullptr) {
+      if(tail == nullptr) {
+         head = rest;
+      }
+      else {
+         nextOf(tail) = rest;
+      }
+      tail = (firstCurrent != nullptr) ? firstTail : secondTail;
+   }
+   count = total;
+}
+
+//----------------------------------------------------------------------------
+// intersect
+// takes two sorted lists and finds the items in common in both lists
+// at termination of the function, the two parameter lists are unchanged
+// unless one is also the current object
+template <typename T>
+void IntrusiveList<T>::intersect(const IntrusiveList<T>& firstList,
+                                 const IntrusiveList<T>& secondList) {
+   // if the calling object is the same as the two arguments
+   // e.g. company1.intersect(company1, company1);
+   if(this == &firstList && this == &secondList) {
+      return;
+   }
+
+   // build the result in a separate list, the current list may be one of
+   // the parameters
+   IntrusiveList<T> result;
+   const T* firstCurrent = firstList.head;
+   const T* secondCurrent = secondList.head;
+   while(firstCurrent != nullptr && secondCurrent != nullptr) {
+      if(*firstCurrent < *secondCurrent) {
+         firstCurrent = nextOf(firstCurrent);
+      }
+      else if(*firstCurrent == *secondCurrent) {
+         result.append(new T(*firstCurrent));
+         firstCurrent = nextOf(firstCurrent);
+         secondCurrent = nextOf(secondCurrent);
+      }
+      else {
+         secondCurrent = nextOf(secondCurrent);
+      }
+   }
+
+   // hand the result's items over to the current list
+   makeEmpty();
+   swap(head, result.head);
+   swap(tail, result.tail);
+   swap(count, result.count);
+}
+
+#endif
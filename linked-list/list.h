@@ -6,6 +6,11 @@
 
 #include <iostream>
 #include <fstream>
+#include <vector>
+#include <algorithm>
+#include <future>
+#include <thread>
+#include "losertree.h"
 using namespace std;
 
 //--------------------------  class List  ------------------------------------
@@ -19,16 +24,32 @@ using namespace std;
 // Assumptions and Implementation:
 //   -- Control of <, printing, etc. of T information is in the T class.
 //   -- BuildList:
+//    - Reads every record into a buffer, sorts it once and links it into
+//      the list in a single pass merged with any items already there,
+//      O(n log n) instead of one O(n) insert per record. Large buffers are
+//      sorted in parallel. Equal items keep their file order and go after
+//      equal items already in the list; records that fail setData are
+//      skipped.
 //   -- Data is linked inside a Node as a pointer
 //    - Nodes are arragned in a sorted linked list
 //   -- Head:
 //    - There is no dummy head node, head points to first node.
 //    - If the list is empty, head is nullptr.
 //    - Head defaults to nullptr at initialization.
+//   -- Tail and Count:
+//    - tail points to the last node, nullptr if the list is empty.
+//    - count is the number of items, returned by size().
+//    - Every function that links or unlinks nodes keeps both up to date.
 //   -- Insert Function:
 //    - Allocates memory for a Node, ptr to the data is passed in.
 //    - Allocating memory and setting data is the responsibility of the
-        caller.
+//      caller.
+//    - An item greater than the last one is linked after tail without
+//      walking the list, so inserting data that is already in order is
+//      O(1) per item.
+//   -- PushBack Function:
+//    - Appends after tail in O(1) when the item is not less than the last
+//      one, otherwise falls back to insert so the list stays sorted.
 //   -- Intersect Function:
 //    - At termination of the function, the two parameter lists are unchanged
 //      unless one is also the current object.
@@ -38,6 +59,14 @@ using namespace std;
 //      one is also the current object
 //    - Duplicate data is allowed
 //    - No new memory is allocated.
+//   -- MergeK and IntersectK Functions:
+//    - Work on any number of lists at once, a LoserTree picks the smallest
+//      head in O(log k) comparisons.
+//    - At termination of the function, the parameter lists are empty; the
+//      current object may be one of them.
+//    - No new memory is allocated: mergeK relinks every node, intersectK
+//      relinks the matching nodes of the first list and deletes the rest.
+//    - intersectMove is intersectK on two lists.
 // Note this definition is not a complete class and is not fully documented.
 //----------------------------------------------------------------------------
 
@@ -67,13 +96,22 @@ public:
    
    void buildList(ifstream&);            // build a List from datafile
 
-   //void merge(List<T>&, List<T>&);
+   void merge(List<T>&, List<T>&);
    void intersect(const List<T>&, const List<T>&);
+
+   // like intersect, but moves the common nodes instead of copying them
+   void intersectMove(List<T>&, List<T>&);
+
+   // merge or intersect any number of lists, which are left empty
+   void mergeK(const vector<List<T>*>&);
+   void intersectK(const vector<List<T>*>&);
    
    bool insert(T*);                      // insert one Node into List
+   bool pushBack(T*);                    // append one Node, O(1) if in order
    bool isEmpty() const;                 // is list empty?
-   //bool retrieve(const T&, T*&) const;   // retrieves a Node from the List
-   //bool remove(const T&, T*&);           // removes an Node form the List
+   int size() const;                     // number of items in the List
+   bool retrieve(const T&, T*&) const;   // retrieves a Node from the List
+   bool remove(const T&, T*&);           // removes an Node form the List
    void makeEmpty();             // deletes the current List
 
 
@@ -85,6 +123,20 @@ private:
    };
 
    Node* head;                   // pointer to first node in list
+   Node* tail;                   // pointer to last node in list
+   int count;                    // number of nodes in list
+
+   // buffers this large are sorted by more than one thread
+   static const int PARALLEL_SORT_CUTOFF = 1 << 15;
+
+   // helpers for buildList
+   static bool lessData(const T*, const T*);
+   static void sortItems(typename vector<T*>::iterator,
+                         typename vector<T*>::iterator, int);
+   void linkSorted(const vector<T*>&);
+
+   // deletes a chain of nodes and their data
+   static void deleteChain(Node*);
 };
 
 
@@ -94,6 +146,8 @@ private:
 template <typename T>
 List<T>::List() {
    head = nullptr;
+   tail = nullptr;
+   count = 0;
 }
 
 //----------------------------------------------------------------------------
@@ -101,6 +155,9 @@ List<T>::List() {
 // copies a list into the current list
 template <typename T>
 List<T>::List(const List<T>& right) {
+   head = nullptr;
+   tail = nullptr;
+   count = 0;
    copy(right);
 }
 
@@ -158,6 +215,8 @@ void List<T>::copy(const List<T>& right) {
    
    // assign the last next in the linked list to a nullptr
    thisCurrent->next = nullptr;
+   tail = thisCurrent;
+   count = right.count;
    
    // clean up pointers
    rightCurrent = nullptr;
@@ -193,6 +252,8 @@ void List<T>::makeEmpty() {
       
       // clean up pointers
       head = nullptr;
+      tail = nullptr;
+      count = 0;
       previous = nullptr;
       current = nullptr;
    }
@@ -206,6 +267,14 @@ bool List<T>::isEmpty() const {
    return head == nullptr;
 }
 
+//----------------------------------------------------------------------------
+// size
+// number of items, kept up to date by every change to the list
+template <typename T>
+int List<T>::size() const {
+   return count;
+}
+
 //----------------------------------------------------------------------------
 // insert
 // insert an item into list; operator< of the T class
@@ -216,12 +285,23 @@ bool List<T>::insert(T* dataptr) {
    Node* ptr= new Node;
    if (ptr == nullptr) return false;              // out of memory, bail
    ptr->data = dataptr;                           // link the node to data
+   count++;
 
    // if the list is empty or if the node should be inserted before
    // the first node of the list
    if (isEmpty() || *ptr->data < *head->data) {
       ptr->next = head;
       head = ptr;
+      if (tail == nullptr) {
+         tail = ptr;
+      }
+   }
+
+   // greater than the last node, link it at the end without walking
+   else if (*tail->data < *ptr->data) {
+      ptr->next = nullptr;
+      tail->next = ptr;
+      tail = ptr;
    }
      
    // then check the rest of the list until we find where it belongs
@@ -238,37 +318,122 @@ bool List<T>::insert(T* dataptr) {
       // insert new node, link it in
       ptr->next = current;
       previous->next = ptr;
+      if (current == nullptr) {
+         tail = ptr;
+      }
    }
    return true;
 }
 
+//----------------------------------------------------------------------------
+// pushBack
+// appends an item after the last node when it is not less than it, equal
+// items go after the ones already in the list; an item that is out of
+// order is inserted where it belongs
+template <typename T>
+bool List<T>::pushBack(T* dataptr) {
+   if (tail != nullptr && *dataptr < *tail->data) {
+      return insert(dataptr);
+   }
+
+   Node* ptr = new Node;
+   ptr->data = dataptr;
+   ptr->next = nullptr;
+   if (tail == nullptr) {
+      head = ptr;
+   }
+   else {
+      tail->next = ptr;
+   }
+   tail = ptr;
+   count++;
+   return true;
+}
+
 //----------------------------------------------------------------------------
 // buildList
-// continually insert new items into the list
+// reads every item of the file, sorts them and links them into the list
 template <typename T>
 void List<T>::buildList(ifstream& infile) {
-   T* ptr;
-   bool successfulRead;                            // read good data
-   bool success = false;                           // successfully insert
+   vector<T*> items;
    for (;;) {
-      ptr = new T;
-      successfulRead = ptr->setData(infile);       // fill the T object
+      T* ptr = new T;
+      bool successfulRead = ptr->setData(infile);  // fill the T object
       if (infile.eof()) {                          // reaches end of file
          delete ptr;
          ptr = nullptr;
          break;
       }
 
-      // insert good data into the list, otherwise ignore it
+      // keep good data, otherwise ignore it
       if (successfulRead) {
-         success = insert(ptr);
+         items.push_back(ptr);
       }
       else {
          delete ptr;
          ptr = nullptr;
       }
-      if (!success) break;
    }
+
+   int depth = 0;
+   while ((1u << depth) < thread::hardware_concurrency()) {
+      depth++;
+   }
+   sortItems(items.begin(), items.end(), depth);
+   linkSorted(items);
+}
+
+//----------------------------------------------------------------------------
+// lessData
+// orders item pointers by operator< of the items
+template <typename T>
+bool List<T>::lessData(const T* left, const T* right) {
+   return *left < *right;
+}
+
+//----------------------------------------------------------------------------
+// sortItems
+// stable sort of [first, last); large ranges sort their halves as separate
+// tasks, depth levels deep, then merge them
+template <typename T>
+void List<T>::sortItems(typename vector<T*>::iterator first,
+                        typename vector<T*>::iterator last, int depth) {
+   if (depth == 0 || last - first < PARALLEL_SORT_CUTOFF) {
+      stable_sort(first, last, lessData);
+      return;
+   }
+   typename vector<T*>::iterator middle = first + (last - first) / 2;
+   future<void> task = async(launch::async, [=]() {
+      sortItems(first, middle, depth - 1);
+   });
+   sortItems(middle, last, depth - 1);
+   task.get();
+   inplace_merge(first, middle, last, lessData);
+}
+
+//----------------------------------------------------------------------------
+// linkSorted
+// links sorted items into the list in one pass, each after the nodes that
+// are not greater than it
+template <typename T>
+void List<T>::linkSorted(const vector<T*>& items) {
+   Node** link = &head;                     // where the next node goes
+   Node* current = head;                    // first node not yet passed
+   for (T* item : items) {
+      while (current != nullptr && !(*item < *current->data)) {
+         link = &current->next;
+         current = current->next;
+      }
+      Node* ptr = new Node;
+      ptr->data = item;
+      ptr->next = current;
+      *link = ptr;
+      link = &ptr->next;
+      if (current == nullptr) {
+         tail = ptr;
+      }
+   }
+   count += items.size();
 }
 
 //----------------------------------------------------------------------------
@@ -360,6 +525,10 @@ bool List<T>::remove(const T& target, T*& p) {
    if(*head->data == target) {
       // walk head to next Node
       head = current;
+      if (head == nullptr) {
+         tail = nullptr;
+      }
+      count--;
       
       // assign object to head's data
       p = previous->data;
@@ -383,11 +552,16 @@ bool List<T>::remove(const T& target, T*& p) {
          
          // update current list
          previous->next = current->next;
+         if (current == tail) {
+            tail = previous;
+         }
+         count--;
          
          // clean up memory
          current->data = nullptr;
          current->next = nullptr;
          delete current;
+         return true;
       }
       else {
          // walk the pointers
@@ -411,85 +585,179 @@ bool List<T>::remove(const T& target, T*& p) {
 template <typename T>
 void List<T>::merge(List<T>& firstList, List<T>& secondList) {
    // if the calling object is the same as the two arguments
-   // e.g. company1.intersect(company1, company1);
+   // e.g. company1.merge(company1, company1);
    if(this == &firstList && this == &secondList) {
       return;
    }
+   vector<List<T>*> lists;
+   lists.push_back(&firstList);
+   lists.push_back(&secondList);
+   mergeK(lists);
+}
 
-   // make the current list empty and attach the fake head's List
-   if(&firstList != this || &secondList != this) {
-      makeEmpty();
+//----------------------------------------------------------------------------
+// mergeK
+// merges any number of sorted lists into the current list; equal items
+// keep the order of the lists they came from
+// At termination of function, the parameter lists are empty, the current
+// list may be one of them
+template <typename T>
+void List<T>::mergeK(const vector<List<T>*>& lists) {
+   // take every chain before emptying the current list, which may be one of
+   // them; a list given twice has no nodes left the second time
+   vector<Node*> chains;
+   vector<const T*> keys;
+   int total = 0;
+   for(List<T>* list : lists) {
+      chains.push_back(list->head);
+      keys.push_back(list->head != nullptr ? list->head->data : nullptr);
+      total += list->count;
+      list->head = nullptr;
+      list->tail = nullptr;
+      list->count = 0;
+   }
+   makeEmpty();
+   if(chains.empty()) {
+      return;
    }
-   // declare a fake head pointer which have nodes attached to the end
-   Node* fakeHead = nullptr;
 
-   if(&firstList == &secondList) {
-      fakeHead = firstList.head;
+   // link the smallest head each time
+   LoserTree<T> tree(keys);
+   Node** link = &head;
+   while(tree.top() != nullptr) {
+      int source = tree.winner();
+      Node* current = chains[source];
+      chains[source] = current->next;
+      *link = current;
+      link = &current->next;
+      tail = current;
+      tree.replaceTop(current->next != nullptr ? current->next->data
+                                               : nullptr);
    }
-   // if the first list is empty assign it to the second
-   else if(firstList.head == nullptr) {
-      fakeHead = secondList.head;
+   *link = nullptr;
+   count = total;
+}
+
+//----------------------------------------------------------------------------
+// intersectMove
+// takes two sorted lists and moves the items in common into the current
+// list without allocating; at termination of the function, the two
+// parameter lists are empty unless one is also the current object
+template <typename T>
+void List<T>::intersectMove(List<T>& firstList, List<T>& secondList) {
+   vector<List<T>*> lists;
+   lists.push_back(&firstList);
+   lists.push_back(&secondList);
+   intersectK(lists);
+}
+
+//----------------------------------------------------------------------------
+// intersectK
+// keeps the items found in every list; an item in every list m or more
+// times is kept m times, as intersect does. The smallest head is advanced
+// until it equals the largest head, then all heads are equal: the first
+// list's node is kept, the others are deleted, and every list moves on.
+// At termination of function, the parameter lists are empty, the current
+// list may be one of them
+template <typename T>
+void List<T>::intersectK(const vector<List<T>*>& lists) {
+   // a list given twice is only used once
+   vector<Node*> chains;
+   vector<const T*> keys;
+   for(size_t i = 0; i < lists.size(); i++) {
+      if(find(lists.begin(), lists.begin() + i, lists[i]) !=
+                                                  lists.begin() + i) {
+         continue;
+      }
+      chains.push_back(lists[i]->head);
+      keys.push_back(lists[i]->head != nullptr ? lists[i]->head->data
+                                               : nullptr);
+      lists[i]->head = nullptr;
+      lists[i]->tail = nullptr;
+      lists[i]->count = 0;
    }
-   // if the second list is empty assign it to the first
-   else if(secondList.head == nullptr) {
-      fakeHead = firstList.head;
+   makeEmpty();
+   if(chains.empty()) {
+      return;
    }
-   // find the intersection
-   else {
-      // declare walker pointers
-      Node* firstCurrent = firstList.head;
-      Node* secondCurrent = secondList.head;
-      Node* thisCurrent = nullptr;
-      
-      // head case
-      if(*firstCurrent->data <= *secondCurrent->data) {
-         fakeHead = firstCurrent;
-         thisCurrent = fakeHead;
-         firstCurrent = firstCurrent->next;
-      }
-      else {
-         fakeHead = secondCurrent;
-         thisCurrent = fakeHead;
-         secondCurrent = secondCurrent->next;
+
+   LoserTree<T> tree(keys);
+   Node** link = &head;
+   bool done = find(keys.begin(), keys.end(), nullptr) != keys.end();
+   const T* largest = nullptr;
+   for(size_t i = 0; !done && i < keys.size(); i++) {
+      if(largest == nullptr || *largest < *keys[i]) {
+         largest = keys[i];
       }
-      
-      // walk each paraemter list finding which nodes have equal data
-      while(firstCurrent != nullptr && secondCurrent != nullptr) {
-         // if first list's data is less than or equal to second
-         if(*firstCurrent->data <= *secondCurrent->data) {
-            thisCurrent->next = firstCurrent;
-            firstCurrent = firstCurrent->next;
-            thisCurrent = thisCurrent->next;
+   }
+
+   while(!done) {
+      int source = tree.winner();
+      if(*tree.top() < *largest) {
+         // the smallest head cannot be in every list
+         Node* current = chains[source];
+         chains[source] = current->next;
+         delete current->data;
+         delete current;
+         if(chains[source] == nullptr) {
+            done = true;
          }
-         // if second list's data is less than or equal to second
          else {
-            thisCurrent->next = secondCurrent;
-            secondCurrent = secondCurrent->next;
-            thisCurrent = thisCurrent->next;
+            if(*largest < *chains[source]->data) {
+               largest = chains[source]->data;
+            }
+            tree.replaceTop(chains[source]->data);
          }
+         continue;
       }
-      
-      // if one list is longer than the other
-      if(firstCurrent == nullptr && secondCurrent != nullptr) {
-         thisCurrent->next = secondCurrent;
+
+      // every head is equal, keep the first list's node
+      for(size_t i = 0; i < chains.size(); i++) {
+         Node* current = chains[i];
+         chains[i] = current->next;
+         if(i == 0) {
+            *link = current;
+            link = &current->next;
+            tail = current;
+            count++;
+         }
+         else {
+            delete current->data;
+            delete current;
+         }
+         keys[i] = (chains[i] != nullptr) ? chains[i]->data : nullptr;
+         if(chains[i] == nullptr) {
+            done = true;
+         }
       }
-      else if(firstCurrent != nullptr && secondCurrent == nullptr) {
-         thisCurrent->next = firstCurrent;
+      if(!done) {
+         largest = keys[0];
+         for(size_t i = 1; i < keys.size(); i++) {
+            if(*largest < *keys[i]) {
+               largest = keys[i];
+            }
+         }
+         tree.reset(keys);
       }
-      
-      // clean up pointers
-      firstCurrent = nullptr;
-      secondCurrent = nullptr;
-      thisCurrent = nullptr;
-   
    }
-   
-   head = fakeHead;
-   
-   // clean up pointers
-   fakeHead = nullptr;
-   firstList.head = nullptr;
-   secondList.head = nullptr;
+   *link = nullptr;
+
+   for(Node* chain : chains) {
+      deleteChain(chain);
+   }
+}
+
+//----------------------------------------------------------------------------
+// deleteChain
+// deletes every node from current to the end and their data
+template <typename T>
+void List<T>::deleteChain(Node* current) {
+   while(current != nullptr) {
+      Node* next = current->next;
+      delete current->data;
+      delete current;
+      current = next;
+   }
 }
  
 //----------------------------------------------------------------------------
@@ -512,6 +780,7 @@ void List<T>::intersect(const List<T>& firstList, const List<T>& secondList) {
    Node* firstCurrent = firstList.head;
    Node* secondCurrent = secondList.head;
    Node* thisCurrent = nullptr;
+   int found = 0;
    
    // walk each list finding which nodes have equal data (intersect)
    while(firstCurrent != nullptr && secondCurrent != nullptr) {
@@ -539,6 +808,7 @@ void List<T>::intersect(const List<T>& firstList, const List<T>& secondList) {
          
          // set the last next in the list to a nullptr
          thisCurrent->next = nullptr;
+         found++;
          
          // walk the first and second list
          firstCurrent = firstCurrent->next;
@@ -553,6 +823,8 @@ void List<T>::intersect(const List<T>& firstList, const List<T>& secondList) {
    // make the current list empty and attach the fake head's List
    makeEmpty();
    head = fakeHead;
+   tail = thisCurrent;
+   count = found;
    
    // clean up pointers
    fakeHead = nullptr;
@@ -0,0 +1,139 @@
+////////////////////////////////  losertree.h file  ///////////////////////////
+// Tournament tree for picking the smallest head among k sorted sources
+
+#ifndef LOSERTREE_H
+#define LOSERTREE_H
+
+#include <vector>
+using namespace std;
+
+//--------------------------  class LoserTree  -------------------------------
+// LoserTree: Keeps the current item of each of k sorted sources and finds
+//           the smallest one. Used by List::mergeK and List::intersectK.
+//
+// Assumptions and Implementation:
+//   -- Control of < of T information is in the T class.
+//   -- Keys are pointers, nullptr means the source is used up and loses to
+//      every item.
+//   -- Ties go to the source with the lower index, so a k-way merge keeps
+//      equal items in source order like List::merge does.
+//   -- Each internal node of the tree holds the loser of the match played
+//      there and tree[0] holds the overall winner. Replacing the winner's
+//      key replays only the matches on its path to the root, ceil(log2 k)
+//      comparisons and no comparison against its sibling's subtree winner.
+//   -- Source i is the leaf at position k + i, so any k works, not only
+//      powers of two.
+//----------------------------------------------------------------------------
+
+template <typename T>
+class LoserTree {
+public:
+   explicit LoserTree(const vector<const T*>&);  // one key per source
+
+   int winner() const;           // source holding the smallest key
+   const T* top() const;         // smallest key, nullptr if all used up
+
+   // the winner's source moved on to key, play its matches again
+   void replaceTop(const T*);
+
+   // start over with new keys for every source, same number of sources
+   void reset(const vector<const T*>&);
+
+private:
+   vector<const T*> keys;        // current key of each source
+   vector<int> tree;             // tree[0] winner, tree[1..k-1] losers
+
+   bool beats(int, int) const;   // does source a win against source b
+   int build(int);               // plays every match below a node
+};
+
+
+//----------------------------------------------------------------------------
+// Constructor
+// plays the whole tournament once
+template <typename T>
+LoserTree<T>::LoserTree(const vector<const T*>& heads) {
+   reset(heads);
+}
+
+//----------------------------------------------------------------------------
+// reset
+// takes new keys and plays the whole tournament, O(k)
+template <typename T>
+void LoserTree<T>::reset(const vector<const T*>& heads) {
+   keys = heads;
+   tree.resize(keys.size() > 0 ? keys.size() : 1);
+   tree[0] = (keys.size() > 1) ? build(1) : 0;
+}
+
+//----------------------------------------------------------------------------
+// build
+// returns the winner of the subtree at node and stores the losers inside it
+template <typename T>
+int LoserTree<T>::build(int node) {
+   int k = keys.size();
+   if(node >= k) {
+      return node - k;                     // a leaf
+   }
+   int left = build(2 * node);
+   int right = build(2 * node + 1);
+   if(beats(left, right)) {
+      tree[node] = right;
+      return left;
+   }
+   tree[node] = left;
+   return right;
+}
+
+//----------------------------------------------------------------------------
+// beats
+// a used up source loses, otherwise the smaller key and then the lower
+// index wins
+template <typename T>
+bool LoserTree<T>::beats(int a, int b) const {
+   if(keys[a] == nullptr) {
+      return false;
+   }
+   if(keys[b] == nullptr) {
+      return true;
+   }
+   if(*keys[a] < *keys[b]) {
+      return true;
+   }
+   return !(*keys[b] < *keys[a]) && a < b;
+}
+
+//----------------------------------------------------------------------------
+// winner
+template <typename T>
+int LoserTree<T>::winner() const {
+   return tree[0];
+}
+
+//----------------------------------------------------------------------------
+// top
+template <typename T>
+const T* LoserTree<T>::top() const {
+   return keys.empty() ? nullptr : keys[tree[0]];
+}
+
+//----------------------------------------------------------------------------
+// replaceTop
+// the new key plays the stored loser at each node on the way to the root,
+// whoever loses stays at that node
+template <typename T>
+void LoserTree<T>::replaceTop(const T* key) {
+   int current = tree[0];
+   keys[current] = key;
+   int k = keys.size();
+   for(int node = (current + k) / 2; node >= 1; node /= 2) {
+      if(beats(tree[node], current)) {
+         int loser = current;
+         current = tree[node];
+         tree[node] = loser;
+      }
+   }
+   tree[0] = current;
+}
+
+#endif
@@ -1,7 +1,15 @@
 #include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
 using namespace std;
 
 #include "list.h"
+#include "rlist.h"
+#include "skiplist.h"
+#include "unrolledlist.h"
+#include "concurrentlist.h"
+#include "intrusivelist.h"
 #include "nodedata.h"
 #include "employee.h"
 
@@ -21,6 +29,370 @@ void testCopyConstructor(List<Object>& byRefList, List<Object> byValList) {
    cout << "byValList is: " << endl << byValList << endl;
 }
 
+//----------------------------- testSortedList ------------------------------
+// Builds lists of employees from the data files with another sorted list
+// engine (SkipList, UnrolledList) and runs the List tests on them:
+// retrieve, remove, copy, ==, merge and intersect.
+//---------------------------------------------------------------------------
+
+template <typename ListType>
+void testSortedList(const string& name) {
+   cout << "Test " << name << endl;
+   cout << "-----" << string(name.size(), '-') << endl;
+   ListType list1, list2, list3, list4;
+   ifstream infile1("data31.txt"), infile2("data32.txt");
+   list1.buildList(infile1);
+   list2.buildList(infile2);
+   cout << "List1:" << endl << list1 << endl;
+   cout << "List2:" << endl << list2 << endl;
+
+   Employee* oneEmployee;
+   Employee emp1("elle", "lam");              // last name, first name
+   Employee emp2("zzzzz", "zz");
+   bool success = list1.retrieve(emp1, oneEmployee);
+   if (success) cout << "Found in list:  " << *oneEmployee << endl;
+   else         cout << "Did not find elle in list" << endl;
+   success = list1.retrieve(emp2, oneEmployee);
+   if (success) cout << "Found in list:  " << *oneEmployee << endl;
+   else         cout << "Did not find zzzzz in list" << endl;
+
+   list3 = list1;
+   cout << "list3 = list1, list3 "
+        << (list3 == list1 ? "equals" : "does not equal") << " list1" << endl;
+   success = list3.remove(emp1, oneEmployee);
+   if (success) {
+      cout << "Removed from list3:  " << *oneEmployee << endl;
+      delete oneEmployee;
+   }
+   cout << "list3 " << (list3 != list1 ? "does not equal" : "equals")
+        << " list1" << endl;
+
+   list4.intersect(list1, list2);
+   cout << "intersect 1 and 2 into 4:" << endl << list4 << endl;
+   list4.merge(list1, list2);
+   cout << "merge 1 and 2 into 4:" << endl << list4 << endl;
+   cout << "list1 is " << (list1.isEmpty() ? "empty" : "not empty")
+        << ", list2 is " << (list2.isEmpty() ? "empty" : "not empty")
+        << endl << endl;
+}
+
+//------------------------------ testManyLists ------------------------------
+// Moves the common items of two lists with intersectMove, then merges
+// and intersects several lists at once with mergeK and intersectK.
+//---------------------------------------------------------------------------
+
+void testManyLists() {
+   cout << "Test intersectMove, mergeK and intersectK" << endl;
+   cout << "-----------------------------------------" << endl;
+   List<Employee> list1, list2, list3, list4, common;
+   ifstream infile1("data31.txt"), infile2("data32.txt"),
+            infile3("data33.txt"), infile4("data34.txt");
+   list1.buildList(infile1);
+   list2.buildList(infile2);
+   list3.buildList(infile3);
+   list4.buildList(infile4);
+   List<Employee> copy1(list1), copy2(list2), both(list1), again(list2);
+
+   common.intersectMove(copy1, copy2);
+   cout << "intersectMove 1 and 2:" << endl << common << endl;
+   cout << "copy1 is " << (copy1.isEmpty() ? "empty" : "not empty")
+        << ", copy2 is " << (copy2.isEmpty() ? "empty" : "not empty")
+        << endl;
+
+   // both holds 1 and 2 merged, so 1, 2 and both have 1 and 2's items
+   // in common
+   both.merge(both, again);
+   vector<List<Employee>*> lists;
+   lists.push_back(&list1);
+   lists.push_back(&list2);
+   lists.push_back(&both);
+   List<Employee> commonK;
+   commonK.intersectK(lists);
+   cout << "intersectK 1, 2 and 1 merged with 2:" << endl << commonK << endl;
+   cout << "intersectK " << (commonK == common ? "equals" : "does not equal")
+        << " intersectMove" << endl;
+
+   // intersectK emptied 1 and 2, read them again
+   lists.clear();
+   infile1.clear();
+   infile1.seekg(0);
+   infile2.clear();
+   infile2.seekg(0);
+   list1.buildList(infile1);
+   list2.buildList(infile2);
+   lists.push_back(&list1);
+   lists.push_back(&list2);
+   lists.push_back(&list3);
+   lists.push_back(&list4);
+   List<Employee> all;
+   all.mergeK(lists);
+   cout << "mergeK of all four files (" << all.size() << " employees):"
+        << endl << all << endl;
+}
+
+//--------------------------- testSkewedSkipList ----------------------------
+// Merges and intersects a long SkipList with a short one, the case the
+// finger searches are for: the short list's items are found by galloping
+// through the long one instead of walking it.
+//---------------------------------------------------------------------------
+
+void testSkewedSkipList() {
+   cout << "Test SkipList merge and intersect, 5 items against 2000" << endl;
+   cout << "-------------------------------------------------------" << endl;
+   SkipList<NodeData> longList, shortList, expected, common;
+   for (int i = 0; i < 4000; i += 2) {
+      longList.insert(new NodeData(i, 'a'));
+      expected.insert(new NodeData(i, 'a'));
+   }
+   int shortItems[] = { 100, 101, 2500, 3998, 5000 };
+   for (int i = 0; i < 5; i++) {
+      shortList.insert(new NodeData(shortItems[i], 'a'));
+      expected.insert(new NodeData(shortItems[i], 'a'));
+   }
+
+   common.intersect(shortList, longList);
+   cout << "intersect:" << endl << common;
+
+   SkipList<NodeData> merged;
+   merged.merge(longList, shortList);
+   cout << "merge " << (merged == expected ? "matches" : "does not match")
+        << " inserting every item, the two lists are "
+        << (longList.isEmpty() && shortList.isEmpty() ? "empty" : "not empty")
+        << endl << endl;
+}
+
+//------------------------------ testPushBack -------------------------------
+// pushBack appends in order and falls back to insert otherwise; tail and
+// size must stay right after remove, makeEmpty, merge and intersect, so
+// every step ends with a pushBack that must go last.
+//---------------------------------------------------------------------------
+
+template <typename ListType>
+bool pushedLast(ListType& list, int num, const string& expected) {
+   list.pushBack(new NodeData(num, 'p'));
+   ostringstream printed;
+   printed << list;
+   string flat = printed.str();
+   for (char& c : flat) {
+      if (c == '\n') c = ',';
+   }
+   return flat == expected;
+}
+
+template <typename ListType>
+void testPushBack(const string& name) {
+   cout << "Test " << name << " pushBack" << endl;
+   cout << "-----" << string(name.size(), '-') << "---------" << endl;
+   ListType list, other, merged, common;
+   bool ok = true;
+   ok = ok && pushedLast(list, 1, "1 p,");
+   ok = ok && pushedLast(list, 3, "1 p,3 p,");
+   ok = ok && pushedLast(list, 5, "1 p,3 p,5 p,");
+   // out of order, inserted where it belongs
+   ok = ok && pushedLast(list, 2, "1 p,2 p,3 p,5 p,");
+   ok = ok && list.size() == 4;
+   cout << "in order and out of order: " << (ok ? "ok" : "wrong") << endl;
+
+   // removing the last item moves tail back
+   NodeData* found;
+   if (list.remove(NodeData(5, 'p'), found)) {
+      delete found;
+   }
+   ok = list.size() == 3 && pushedLast(list, 6, "1 p,2 p,3 p,6 p,");
+   cout << "after remove of the last item: " << (ok ? "ok" : "wrong")
+        << endl;
+
+   list.makeEmpty();
+   ok = list.size() == 0 && pushedLast(list, 1, "1 p,");
+   list.pushBack(new NodeData(4, 'p'));
+   other.pushBack(new NodeData(2, 'p'));
+   other.pushBack(new NodeData(4, 'p'));
+   other.pushBack(new NodeData(9, 'p'));
+
+   common.intersect(list, other);
+   ok = ok && common.size() == 1 && pushedLast(common, 5, "4 p,5 p,");
+   merged.merge(list, other);
+   ok = ok && merged.size() == 5 && list.size() == 0 && other.size() == 0 &&
+        pushedLast(merged, 10, "1 p,2 p,4 p,4 p,9 p,10 p,") &&
+        pushedLast(list, 3, "3 p,");
+   cout << "after makeEmpty, intersect and merge: " << (ok ? "ok" : "wrong")
+        << endl << endl;
+}
+
+//------------------------------ testRListTail ------------------------------
+// moveToEnd and removeEveryOther, which only RList has, must leave tail on
+// the last node too.
+//---------------------------------------------------------------------------
+
+void testRListTail() {
+   RList<NodeData> list;
+   for (int i = 1; i <= 4; i++) {
+      list.pushBack(new NodeData(i, 'p'));
+   }
+   // moveToEnd breaks the order on purpose, pushBack of a larger item
+   // still appends after the new tail
+   list.moveToEnd(NodeData(1, 'p'));
+   bool ok = pushedLast(list, 7, "2 p,3 p,4 p,1 p,7 p,") && list.size() == 5;
+   list.removeEveryOther();
+   ok = ok && list.size() == 2 && pushedLast(list, 8, "3 p,1 p,8 p,");
+   cout << "RList after moveToEnd and removeEveryOther: "
+        << (ok ? "ok" : "wrong") << endl << endl;
+}
+
+//----------------------------- testLongRList -------------------------------
+// Runs every RList operation on lists long enough that one call per node
+// would overflow the stack.
+//---------------------------------------------------------------------------
+
+void testLongRList() {
+   cout << "Test RList on 100000 items" << endl;
+   cout << "--------------------------" << endl;
+   const int N = 100000;
+   RList<NodeData> evens, odds;
+   for (int i = 0; i < N; i++) {
+      evens.pushBack(new NodeData(2 * i, 'a'));
+      odds.pushBack(new NodeData(2 * i + 1, 'a'));
+   }
+
+   RList<NodeData> copy(evens), common;
+   cout << "copy " << (copy == evens ? "==" : "!=") << " evens" << endl;
+   common.intersect(evens, copy);
+   cout << "intersect evens and copy, " << common.size() << " items, "
+        << (common == evens ? "==" : "!=") << " evens" << endl;
+
+   NodeData* found;
+   if (copy.remove(NodeData(2 * N - 2, 'a'), found)) {
+      delete found;
+   }
+   cout << "after removing the last item, copy has " << copy.size()
+        << " items and " << (copy != evens ? "!=" : "==") << " evens" << endl;
+
+   RList<NodeData> all;
+   all.merge(evens, odds);
+   cout << "merge evens and odds, " << all.size() << " items, evens and odds"
+        << " are " << (evens.isEmpty() && odds.isEmpty() ? "empty" : "not empty")
+        << endl;
+   copy.merge(copy, common);
+   cout << "merge copy with itself and common, " << copy.size() << " items"
+        << endl;
+
+   // printBackwards writes to cout, catch it to compare with the items
+   ostringstream backwards, expected;
+   streambuf* coutBuffer = cout.rdbuf(backwards.rdbuf());
+   all.printBackwards();
+   cout.rdbuf(coutBuffer);
+   for (int i = 2 * N - 1; i >= 0; i--) {
+      expected << NodeData(i, 'a');
+   }
+   cout << "printBackwards "
+        << (backwards.str() == expected.str() ? "matches" : "does not match")
+        << " the items in reverse" << endl << endl;
+}
+
+//-------------------------- class HookedEmployee ---------------------------
+// An Employee that carries its own link, so it can be in an IntrusiveList
+//---------------------------------------------------------------------------
+
+class HookedEmployee : public Employee, public ListHook<HookedEmployee> {
+public:
+   HookedEmployee(string last = "dummyLast", string first = "dummyFirst")
+      : Employee(last, first) {}
+};
+
+//--------------------------- testIntrusiveList -----------------------------
+// Same steps as testSortedList, on a list whose items hold their own link
+//---------------------------------------------------------------------------
+
+void testIntrusiveList() {
+   cout << "Test IntrusiveList" << endl;
+   cout << "------------------" << endl;
+   IntrusiveList<HookedEmployee> list1, list2, list3, common;
+   ifstream infile1("data31.txt"), infile2("data32.txt");
+   list1.buildList(infile1);
+   list2.buildList(infile2);
+   cout << "list1 has " << list1.size() << " employees:" << endl << list1
+        << endl;
+
+   HookedEmployee* found;
+   HookedEmployee key("elle", "lam");
+   cout << "elle lam " << (list1.retrieve(key, found) ? "found" : "not found")
+        << endl;
+
+   list3 = list1;
+   cout << "list3 " << (list3 == list1 ? "==" : "!=") << " list1" << endl;
+   if (list3.remove(key, found)) {
+      delete found;
+   }
+   cout << "after remove, list3 " << (list3 == list1 ? "==" : "!=")
+        << " list1" << endl;
+
+   common.intersect(list1, list2);
+   cout << "intersect list1 and list2:" << endl << common << endl;
+
+   list3.merge(list1, list2);
+   cout << "merge list1 and list2, " << list3.size() << " employees, "
+        << "list1 and list2 are "
+        << (list1.isEmpty() && list2.isEmpty() ? "empty" : "not empty")
+        << endl << endl;
+}
+
+//---------------------------- concurrentWorker -----------------------------
+// One thread of testConcurrentList: inserts its own keys, removes the odd
+// ones and retrieves the even ones while the other threads do the same.
+//---------------------------------------------------------------------------
+
+void concurrentWorker(ConcurrentList<NodeData>* list, int first, int count,
+                      int* found) {
+   for (int i = first; i < first + count; i++) {
+      list->insert(new NodeData(i, 'a'));
+   }
+   for (int i = first + 1; i < first + count; i += 2) {
+      NodeData* removed;
+      if (list->remove(NodeData(i, 'a'), removed)) {
+         delete removed;
+      }
+   }
+   *found = 0;
+   for (int i = first; i < first + count; i += 2) {
+      NodeData item;
+      if (list->retrieve(NodeData(i, 'a'), item) && item == NodeData(i, 'a')) {
+         (*found)++;
+      }
+   }
+}
+
+//--------------------------- testConcurrentList ----------------------------
+// Several threads insert, remove and retrieve at once, then the contents
+// are checked: every even key is there and every odd one is gone.
+//---------------------------------------------------------------------------
+
+void testConcurrentList() {
+   cout << "Test ConcurrentList" << endl;
+   cout << "-------------------" << endl;
+   const int THREADS = 4, COUNT = 200;
+   ConcurrentList<NodeData> list;
+   vector<thread> threads;
+   vector<int> found(THREADS);
+   for (int t = 0; t < THREADS; t++) {
+      threads.push_back(thread(concurrentWorker, &list, t * COUNT, COUNT,
+                               &found[t]));
+   }
+   for (int t = 0; t < THREADS; t++) {
+      threads[t].join();
+   }
+
+   bool match = list.size() == THREADS * COUNT / 2;
+   for (int t = 0; t < THREADS; t++) {
+      match = match && found[t] == COUNT / 2;
+   }
+   for (int i = 0; i < THREADS * COUNT; i++) {
+      NodeData item;
+      match = match && list.retrieve(NodeData(i, 'a'), item) == (i % 2 == 0);
+   }
+   cout << THREADS << " threads, " << list.size() << " items left, "
+        << "contents match: " << (match ? "yes" : "no") << endl << endl;
+}
+
 int main() {
    // list of NodeData, to be sorted by numerical value, then char
    List<NodeData> mylist, mylist2, mylist3;
@@ -44,7 +416,7 @@ int main() {
    // to be sorted alphabetically by last name, then first.
    // Vary the data files to test your list code.
    bool success;
-   Employee* oneEmployee;
+   Employee* oneEmployee = nullptr;
    List<Employee> company1, company2, company3, company4, company5, company6, 
                   company7, company8, company9, company10, company11;
    ifstream infile1("data31.txt"), infile2("data32.txt"),
@@ -170,6 +542,17 @@ int main() {
    
    testCopyConstructor(company10, company10);
    cout << "back in main, Company10:" << endl << company10 << endl;
+
+   testSortedList<SkipList<Employee> >("SkipList");
+   testSortedList<UnrolledList<Employee> >("UnrolledList");
+   testManyLists();
+   testSkewedSkipList();
+   testPushBack<List<NodeData> >("List");
+   testPushBack<RList<NodeData> >("RList");
+   testRListTail();
+   testLongRList();
+   testIntrusiveList();
+   testConcurrentList();
    
 /* ADDITIONAL TESTING
    List<Employee> company1;
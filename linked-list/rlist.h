@@ -1,15 +1,16 @@
 ////////////////////////////////////////////////////////////////////  listtemplate.h file  /////////////////////////////////////////////////////////////////
 // Simple linked list, uses Node as linked list node
 
-#ifndef LIST_H
-#define LIST_H
+#ifndef RLIST_H
+#define RLIST_H
 
 #include <iostream>
 #include <fstream>
+#include <vector>
 using namespace std;
 
-//--------------------------  class List  ------------------------------------
-// ADT List: Finite, ordered collection of zero or more items.
+//--------------------------  class RList  -----------------------------------
+// ADT RList: Finite, ordered collection of zero or more items.
 //           The ordering is determined by operator< of T class.
 //           Ability to find union of two lists
 //           Ability to find intersection of two lists
@@ -25,10 +26,27 @@ using namespace std;
 //    - There is no dummy head node, head points to first node.
 //    - If the list is empty, head is nullptr.
 //    - Head defaults to nullptr at initialization.
+//   -- Helpers:
+//    - Every helper walks the list with a loop instead of one recursive
+//      call per node, so the stack does not grow with the list and long
+//      lists cannot overflow it.
+//    - printBackwards keeps a checkpoint every sqrt(n) nodes and prints
+//      one chunk at a time from the last one, O(n) time and O(sqrt(n))
+//      extra memory, the list is not changed.
+//   -- Tail and Count:
+//    - tail points to the last node, nullptr if the list is empty.
+//    - count is the number of items, returned by size().
+//    - moveToEnd relinks the found node after tail instead of walking to
+//      the end again.
 //   -- Insert Function:
 //    - Allocates memory for a Node, ptr to the data is passed in.
 //    - Allocating memory and setting data is the responsibility of the
 //      caller.
+//    - An item greater than the last one is linked after tail without
+//      walking the list.
+//   -- PushBack Function:
+//    - Appends after tail in O(1) when the item is not less than the last
+//      one, otherwise falls back to insert so the list stays sorted.
 //   -- Intersect Function:
 //    - At termination of the function, the two parameter lists are unchanged
 //      unless one is also the current object.
@@ -42,12 +60,12 @@ using namespace std;
 //----------------------------------------------------------------------------
 
 template <typename T>
-class List {
+class RList {
 
-   // output operator for class List, print data,
+   // output operator for class RList, print data,
    // responsibility for output is left to object stored in the list
-   friend ostream& operator<<(ostream& output, const List<T>& thelist) {
-      typename List<T>::Node* current = thelist.head;
+   friend ostream& operator<<(ostream& output, const RList<T>& thelist) {
+      typename RList<T>::Node* current = thelist.head;
       while (current != nullptr) {
          output << *current->data;
          current = current->next;
@@ -56,18 +74,20 @@ class List {
 }
 
 public:
-   List();                              // default constructor
-   ~List();                             // destructor
-   List(const List<T>&);                // copy constructor
+   RList();                             // default constructor
+   ~RList();                            // destructor
+   RList(const RList<T>&);              // copy constructor
    
    void makeEmpty();                    // deletes the current List
    void buildList(ifstream&);            // build a List from datafile
 
-   void merge(List<T>&, List<T>&);
-   void intersect(const List<T>&, const List<T>&);
+   void merge(RList<T>&, RList<T>&);
+   void intersect(const RList<T>&, const RList<T>&);
    
    bool insert(T*);                      // insert one Node into List
+   bool pushBack(T*);                    // append one Node, O(1) if in order
    bool isEmpty() const;                 // is list empty?
+   int size() const;                     // number of items in the List
    bool retrieve(const T&, T*&) const;   // retrieves a Node from the List
    bool remove(const T&, T*&);           // removes an Node form the List
 
@@ -76,18 +96,20 @@ public:
    void printBackwards() const;
    
    // operator overloads
-   const List<T>& operator=(const List<T>&);        // =operator overload
-   bool operator==(const List<T>&) const;           // ==operator overload
-   bool operator!=(const List<T>&) const;           // !=operator overload
+   const RList<T>& operator=(const RList<T>&);      // =operator overload
+   bool operator==(const RList<T>&) const;          // ==operator overload
+   bool operator!=(const RList<T>&) const;          // !=operator overload
 
 private:
-   void copy(const List<T>&);    // copies the current list
+   void copy(const RList<T>&);   // copies the current list
    struct Node {                 // the node in a linked list
       T* data;                   // pointer to actual data, operations in T
       Node* next;
    };
 
    Node* head;                   // pointer to first node in list
+   Node* tail;                   // pointer to last node in list
+   int count;                    // number of nodes in list
 
    void copyHelper(Node*&, const Node*);      // copies the current list
    void makeEmptyHelper(Node*&);              // deletes the current List
@@ -96,10 +118,10 @@ private:
    
    bool equalityHelper(const Node*, const Node*) const;
    bool retrieveHelper(const Node*, const T&, T*&) const;
-   bool removeHelper(const Node*, const T&, T*&);
+   bool removeHelper(Node*&, Node*, const T&, T*&);
    /*
-   void mergeHelper(List<T>&, List<T>&);
-   void intersectHelper(const List<T>&, const List<T>&);
+   void mergeHelper(RList<T>&, RList<T>&);
+   void intersectHelper(const RList<T>&, const RList<T>&);
 
    
    
@@ -115,15 +137,20 @@ private:
 // Constructor
 // deafults the head to a nullptr
 template <typename T>
-List<T>::List() {
+RList<T>::RList() {
    head = nullptr;
+   tail = nullptr;
+   count = 0;
 }
 
 //----------------------------------------------------------------------------
 // Copy Constructor
 // copies a list into the current list
 template <typename T>
-List<T>::List(const List<T>& right) {
+RList<T>::RList(const RList<T>& right) {
+   head = nullptr;
+   tail = nullptr;
+   count = 0;
    copy(right);
 }
 
@@ -131,7 +158,7 @@ List<T>::List(const List<T>& right) {
 // Destructor
 // empties a list
 template <typename T>
-List<T>::~List() {
+RList<T>::~RList() {
    makeEmpty();
 }
 
@@ -140,7 +167,7 @@ List<T>::~List() {
 // operator=
 // copies a list into the current list
 template <typename T>
-const List<T>& List<T>::operator=(const List<T>& right) {
+const RList<T>& RList<T>::operator=(const RList<T>& right) {
    if(this != &right) {          // if current list is same as argument
       makeEmpty();
       copy(right);
@@ -152,70 +179,93 @@ const List<T>& List<T>::operator=(const List<T>& right) {
 // copy
 // copies a list into the current list
 template <typename T>
-void List<T>::copy(const List<T>& right) {
+void RList<T>::copy(const RList<T>& right) {
    copyHelper(head, right.head);
+   count = right.count;
 }
 
 //----------------------------------------------------------------------------
+// copyHelper
+// appends a copy of every node from rightCurrent on at link current
 template <typename T>
-void List<T>::copyHelper(Node*& current, const Node* rightCurrent) {
-   if(rightCurrent == nullptr) {
-      return;
+void RList<T>::copyHelper(Node*& current, const Node* rightCurrent) {
+   Node** link = &current;                  // where the next copy goes
+   while(rightCurrent != nullptr) {
+      Node* ptr = new Node;
+      ptr->data = new T(*rightCurrent->data);
+      ptr->next = nullptr;
+      *link = ptr;
+      link = &ptr->next;
+      tail = ptr;
+      rightCurrent = rightCurrent->next;
    }
-   current = new Node;
-   current->data = new T(*rightCurrent->data);
-   current->next = nullptr;
-   copyHelper(current->next, rightCurrent->next);
 }
 
 //----------------------------------------------------------------------------
 // makeEmpty
 // empties the current object
 template <typename T>
-void List<T>::makeEmpty() {
+void RList<T>::makeEmpty() {
    makeEmptyHelper(head);
+   tail = nullptr;
+   count = 0;
 }
 
 //----------------------------------------------------------------------------
 // makeEmptyHelper
 // empties the current object
 template <typename T>
-void List<T>::makeEmptyHelper(Node*& current) {
-   if(current == nullptr) {
-      return;
+void RList<T>::makeEmptyHelper(Node*& current) {
+   while(current != nullptr) {
+      Node* next = current->next;
+      delete current->data;
+      current->data = nullptr;
+      delete current;
+      current = next;
    }
-   
-   makeEmptyHelper(current->next);
-   
-   delete current->data;
-   current->data = nullptr;
-   delete current;
-   current = nullptr;
 }
 
 //----------------------------------------------------------------------------
 // isEmpty
 // check to see if List is empty as defined by a nullptr head
 template <typename T>
-bool List<T>::isEmpty() const {
+bool RList<T>::isEmpty() const {
    return head == nullptr;
 }
 
+//----------------------------------------------------------------------------
+// size
+// number of items, kept up to date by every change to the list
+template <typename T>
+int RList<T>::size() const {
+   return count;
+}
+
 //----------------------------------------------------------------------------
 // insert
 // insert an item into list; operator< of the T class
 // has the responsibility for the sorting criteria
 template <typename T>
-bool List<T>::insert(T* dataptr) {
+bool RList<T>::insert(T* dataptr) {
 
    Node* ptr= new Node;
    if (ptr == nullptr) return false;              // out of memory, bail
    ptr->data = dataptr;                           // link the node to data
+   count++;
 
    // if the list is empty or node ptr should be inserted before head
    if (isEmpty() || *ptr->data < *head->data) {
       ptr->next = head;
       head = ptr;
+      if (tail == nullptr) {
+         tail = ptr;
+      }
+   }
+   // greater than the last node, link it at the end without walking
+   else if (*tail->data < *ptr->data) {
+      ptr->next = nullptr;
+      tail->next = ptr;
+      tail = ptr;
    }
    // then check the rest of the list until we find where it belongs
    else {
@@ -229,21 +279,49 @@ bool List<T>::insert(T* dataptr) {
 // insert an item into list; operator< of the T class
 // has the responsibility for the sorting criteria
 template <typename T>
-bool List<T>::insertHelper(Node*& current, Node* dataptr) {
-   if(current == nullptr || *current->data > *dataptr->data) {
-      Node* temp = current;
-      current = dataptr;
-      current->next = temp;
-      return true;
-   }
-   return insertHelper(current->next, dataptr);
+bool RList<T>::insertHelper(Node*& current, Node* dataptr) {
+   Node** link = &current;                  // link the node goes into
+   while(*link != nullptr && !(*(*link)->data > *dataptr->data)) {
+      link = &(*link)->next;
+   }
+   dataptr->next = *link;
+   *link = dataptr;
+   if(dataptr->next == nullptr) {
+      tail = dataptr;
+   }
+   return true;
+}
+
+//----------------------------------------------------------------------------
+// pushBack
+// appends an item after the last node when it is not less than it, equal
+// items go after the ones already in the list; an item that is out of
+// order is inserted where it belongs
+template <typename T>
+bool RList<T>::pushBack(T* dataptr) {
+   if (tail != nullptr && *dataptr < *tail->data) {
+      return insert(dataptr);
+   }
+
+   Node* ptr = new Node;
+   ptr->data = dataptr;
+   ptr->next = nullptr;
+   if (tail == nullptr) {
+      head = ptr;
+   }
+   else {
+      tail->next = ptr;
+   }
+   tail = ptr;
+   count++;
+   return true;
 }
 
 //----------------------------------------------------------------------------
 // buildList
 // continually insert new items into the list
 template <typename T>
-void List<T>::buildList(ifstream& infile) {
+void RList<T>::buildList(ifstream& infile) {
    T* ptr;
    bool successfulRead;                            // read good data
    bool success = false;                           // successfully insert
@@ -272,7 +350,7 @@ void List<T>::buildList(ifstream& infile) {
 // operator==
 // finds if two lists are equal
 template <typename T>
-bool List<T>::operator==(const List<T>& right) const {
+bool RList<T>::operator==(const RList<T>& right) const {
    // if the current object is same as right
    if(this == &right) return true;
    else return equalityHelper(head, right.head);
@@ -283,18 +361,20 @@ bool List<T>::operator==(const List<T>& right) const {
 // equalityHelper
 // finds if two lists are equal
 template <typename T>
-bool List<T>::equalityHelper(const Node* current, const Node* rightCurrent) const {
-   if(!rightCurrent && current) return false;
-   else if(rightCurrent && !current) return false;
-   else if(!rightCurrent && !current) return true;
-   return (*current->data == *rightCurrent->data && equalityHelper(current->next, rightCurrent->next));
+bool RList<T>::equalityHelper(const Node* current, const Node* rightCurrent) const {
+   while(current != nullptr && rightCurrent != nullptr) {
+      if(!(*current->data == *rightCurrent->data)) return false;
+      current = current->next;
+      rightCurrent = rightCurrent->next;
+   }
+   return current == nullptr && rightCurrent == nullptr;
 }
 
 //----------------------------------------------------------------------------
 // operator!=
 // utilizes definition of == to find if two lists are not equal
 template <typename T>
-bool List<T>::operator!=(const List<T>& right) const {
+bool RList<T>::operator!=(const RList<T>& right) const {
    return !(*this == right);
 }
 
@@ -303,7 +383,7 @@ bool List<T>::operator!=(const List<T>& right) const {
 // retrieve
 // retrieves a data object from the linked list
 template <typename T>
-bool List<T>::retrieve(const T& target, T*& p) const {
+bool RList<T>::retrieve(const T& target, T*& p) const {
    if(head == nullptr) {
       return false;
    }
@@ -312,48 +392,58 @@ bool List<T>::retrieve(const T& target, T*& p) const {
 }
  
 //----------------------------------------------------------------------------
-// retrieve
+// retrieveHelper
 // retrieves a data object from the linked list
 template <typename T>
-bool List<T>::retrieveHelper(const Node* current, const T& target, T*& p) const {
-   if(current == nullptr) {
-      p = nullptr;
-      return false;
-   }
-   else if(*current->data == target) {
-      p = current->data;
-      return true;
+bool RList<T>::retrieveHelper(const Node* current, const T& target, T*& p) const {
+   while(current != nullptr) {
+      if(*current->data == target) {
+         p = current->data;
+         return true;
+      }
+      current = current->next;
    }
-   return retrieveHelper(current->next, target, p);
+   p = nullptr;
+   return false;
 }
 
 //----------------------------------------------------------------------------
 // remove
 // retrieves an object and removes it's Node from the List
 template <typename T>
-bool List<T>::remove(const T& target, T*& p) {
+bool RList<T>::remove(const T& target, T*& p) {
    if(head == nullptr) {
       return false;
    }
    
-   return removeHelper(head, target, p);
+   return removeHelper(head, nullptr, target, p);
 }
  
 //----------------------------------------------------------------------------
-// remove
-// retrieves an object and removes it's Node from the List
+// removeHelper
+// unlinks the first node equal to target, current is the link that points
+// to it and previous the node holding that link, nullptr for head
 template <typename T>
-bool List<T>::removeHelper(const Node* current, const T& target, T*& p) {
-   if(current == nullptr) {
+bool RList<T>::removeHelper(Node*& current, Node* previous, const T& target,
+                           T*& p) {
+   Node** link = &current;                  // link that points to the node
+   while(*link != nullptr && *(*link)->data != target) {
+      previous = *link;
+      link = &previous->next;
+   }
+   if(*link == nullptr) {
       p = nullptr;
       return false;
    }
-   else if(*current->data == target) {
-      p = current->data;
-      current = current->next;
-      return true;
+   Node* found = *link;
+   p = found->data;
+   *link = found->next;
+   if(found == tail) {
+      tail = previous;
    }
-   return removeHelper(current->next, target, p);
+   count--;
+   delete found;
+   return true;
 }
 
 //----------------------------------------------------------------------------
@@ -362,36 +452,46 @@ bool List<T>::removeHelper(const Node* current, const T& target, T*& p) {
 // At termination of function, the two parameter lists are empty unless one
 // is also the current object
 template <typename T>
-void List<T>::merge(List<T>& firstList, List<T>& secondList) {
+void RList<T>::merge(RList<T>& firstList, RList<T>& secondList) {
    // if the calling object is the same as the two arguments
    // e.g. company1.intersect(company1, company1);
    if(this == &firstList && this == &secondList) {
       return;
    }
 
-   // make the current list empty and attach the fake head's List
-   if(&firstList != this || &secondList != this) {
-      makeEmpty();
-   }
+   // take both chains before emptying the current list, which may be one of
+   // them; a list given twice has no nodes left the second time
+   Node* firstCurrent = firstList.head;
+   Node* firstTail = firstList.tail;
+   int total = firstList.count;
+   firstList.head = nullptr;
+   firstList.tail = nullptr;
+   firstList.count = 0;
+   Node* secondCurrent = secondList.head;
+   Node* secondTail = secondList.tail;
+   total += secondList.count;
+   secondList.head = nullptr;
+   secondList.tail = nullptr;
+   secondList.count = 0;
+   makeEmpty();
+
    // declare a fake head pointer which have nodes attached to the end
    Node* fakeHead = nullptr;
+   Node* fakeTail = nullptr;
 
-   if(&firstList == &secondList) {
-      fakeHead = firstList.head;
-   }
    // if the first list is empty assign it to the second
-   else if(firstList.head == nullptr) {
-      fakeHead = secondList.head;
+   if(firstCurrent == nullptr) {
+      fakeHead = secondCurrent;
+      fakeTail = secondTail;
    }
    // if the second list is empty assign it to the first
-   else if(secondList.head == nullptr) {
-      fakeHead = firstList.head;
+   else if(secondCurrent == nullptr) {
+      fakeHead = firstCurrent;
+      fakeTail = firstTail;
    }
-   // find the intersection
+   // merge the two chains
    else {
-      // declare walker pointers
-      Node* firstCurrent = firstList.head;
-      Node* secondCurrent = secondList.head;
+      // declare walker pointer
       Node* thisCurrent = nullptr;
       
       // head case
@@ -425,9 +525,11 @@ void List<T>::merge(List<T>& firstList, List<T>& secondList) {
       // if one list is longer than the other
       if(firstCurrent == nullptr && secondCurrent != nullptr) {
          thisCurrent->next = secondCurrent;
+         fakeTail = secondTail;
       }
       else if(firstCurrent != nullptr && secondCurrent == nullptr) {
          thisCurrent->next = firstCurrent;
+         fakeTail = firstTail;
       }
       
       // clean up pointers
@@ -436,13 +538,14 @@ void List<T>::merge(List<T>& firstList, List<T>& secondList) {
       thisCurrent = nullptr;
    
    }
-   
+
    head = fakeHead;
+   tail = fakeTail;
+   count = total;
    
    // clean up pointers
    fakeHead = nullptr;
-   firstList.head = nullptr;
-   secondList.head = nullptr;
+   fakeTail = nullptr;
 }
 
  
@@ -452,7 +555,7 @@ void List<T>::merge(List<T>& firstList, List<T>& secondList) {
 // at termination of the function, the two parameter lists are unchanged
 // unless one is also the current object
 template <typename T>
-void List<T>::intersect(const List<T>& firstList, const List<T>& secondList) {
+void RList<T>::intersect(const RList<T>& firstList, const RList<T>& secondList) {
    // if the calling object is the same as the two arguments
    // e.g. company1.intersect(company1, company1);
    if(this == &firstList && this == &secondList) {
@@ -466,6 +569,7 @@ void List<T>::intersect(const List<T>& firstList, const List<T>& secondList) {
    Node* firstCurrent = firstList.head;
    Node* secondCurrent = secondList.head;
    Node* thisCurrent = nullptr;
+   int found = 0;
    
    // walk each list finding which nodes have equal data (intersect)
    while(firstCurrent != nullptr && secondCurrent != nullptr) {
@@ -493,6 +597,7 @@ void List<T>::intersect(const List<T>& firstList, const List<T>& secondList) {
          
          // set the last next in the list to a nullptr
          thisCurrent->next = nullptr;
+         found++;
          
          // walk the first and second list
          firstCurrent = firstCurrent->next;
@@ -507,6 +612,8 @@ void List<T>::intersect(const List<T>& firstList, const List<T>& secondList) {
    // make the current list empty and attach the fake head's List
    makeEmpty();
    head = fakeHead;
+   tail = thisCurrent;
+   count = found;
    
    // clean up pointers
    fakeHead = nullptr;
@@ -517,49 +624,42 @@ void List<T>::intersect(const List<T>& firstList, const List<T>& secondList) {
 }
 
 //----------------------------------------------------------------------------
+// moveToEnd
+// unlinks the first node equal to target and links it after tail, the
+// rest of the list is not walked again
 template <typename T>
-void List<T>::moveToEnd(const T& target) {
+void RList<T>::moveToEnd(const T& target) {
    if(head == nullptr) {
       return;
    }
    
-   // previous will hold the target node if found
-   Node* previous = head;
-   Node* current = head->next;
-   bool found = false;
+   // previous will hold the node before the target if found
+   Node* previous = nullptr;
+   Node* current = head;
+   while(current != nullptr && *current->data != target) {
+      previous = current;
+      current = current->next;
+   }
+   
+   // not found or already last
+   if(current == nullptr || current == tail) {
+      return;
+   }
    
-   // head case
-   if(*head->data == target) {
-      head = current;
-      previous->next = nullptr;
+   if(previous == nullptr) {
+      head = current->next;
    }
    else {
-      
-      while(current != nullptr) {
-         if(*current->data == target) {
-            previous->next = current>next;
-            previous = current;
-            found = true;
-            break;
-         }
-         else {
-            previous = current;
-            current = current->next;
-         }
-      }
-      
-      if(found) {
-         while(current->next != nullptr) {
-            current = current->next;
-         }
-         current->next = previous;
-      }
+      previous->next = current->next;
    }
+   tail->next = current;
+   current->next = nullptr;
+   tail = current;
 }
 
 //----------------------------------------------------------------------------
 template <typename T>
-void List<T>::removeEveryOther() {
+void RList<T>::removeEveryOther() {
    if(isEmpty()) {
       return;
    }
@@ -574,8 +674,11 @@ void List<T>::removeEveryOther() {
       previous->next = nullptr;
       delete previous;
       previous = current;
+      count -= (count + 1) / 2;          // odd positions are removed
+      tail = current;
 
       while(current != nullptr && current->next != nullptr) {
+         tail = previous;                // last node kept so far
          current = current->next;
          previous->next = current->next;
          previous = current;
@@ -587,25 +690,50 @@ void List<T>::removeEveryOther() {
          delete previous;
          previous = current;
       }
+      if(current != nullptr) {
+         tail = current;
+      }
    }
 }
 
 //----------------------------------------------------------------------------
 // printBackwards
 template <typename T>
-void List<T>::printBackwards() const {
+void RList<T>::printBackwards() const {
    printBackwardsHelper(head);
 }
 //----------------------------------------------------------------------------
 // printBackwardsHelper
+// prints the nodes from current on in reverse order without recursion
 template <typename T>
-void List<T>::printBackwardsHelper(Node* current) const {
-   if(current == nullptr) {
-      return;
+void RList<T>::printBackwardsHelper(Node* current) const {
+   // chunk length about sqrt(count), so neither buffer grows past that
+   int step = 1;
+   while(step * step < count) {
+      step++;
+   }
+
+   // first node of every chunk, front to back
+   vector<const Node*> starts;
+   for(int i = 0; current != nullptr; current = current->next, i++) {
+      if(i % step == 0) {
+         starts.push_back(current);
+      }
+   }
+
+   // print the chunks from the last one, each one backwards
+   vector<const Node*> chunk;
+   for(int i = starts.size() - 1; i >= 0; i--) {
+      chunk.clear();
+      const Node* walker = starts[i];
+      for(int j = 0; j < step && walker != nullptr; j++) {
+         chunk.push_back(walker);
+         walker = walker->next;
+      }
+      for(int j = chunk.size() - 1; j >= 0; j--) {
+         cout << *chunk[j]->data;
+      }
    }
-   
-   printBackwardsHelper(current->next);
-   cout << *current->data;
 }
 
 #endif
@@ -0,0 +1,590 @@
+////////////////////////////////  skiplist.h file  ////////////////////////////
+// Sorted skip list, same interface as List in list.h
+
+#ifndef SKIPLIST_H
+#define SKIPLIST_H
+
+#include <iostream>
+#include <fstream>
+#include <new>
+#include <utility>
+using namespace std;
+
+//--------------------------  class SkipList  --------------------------------
+// ADT SkipList: Finite, ordered collection of zero or more items.
+//           The ordering is determined by operator< of T class.
+//           Ability to find union of two lists
+//           Ability to find intersection of two lists
+//           Ability to retrieve data from a list
+//           Ability to remove data from a list
+//
+// Assumptions and Implementation:
+//   -- Control of <, printing, etc. of T information is in the T class.
+//   -- Levels:
+//    - Every node is on level 0, which is an ordinary sorted linked list.
+//    - A node is also on levels 1 .. height-1, each level skipping over
+//      about three of every four nodes of the level below, so insert,
+//      retrieve and remove go down from the top level in expected
+//      O(log n) steps instead of walking the whole list.
+//    - Node heights are random with a 1/4 chance of each extra level, so
+//      the expected number of links per node is 4/3.
+//   -- Fingers:
+//    - A finger is the last node on each level before some item. Searching
+//      again for a larger item starts at the finger, climbs only as high
+//      as the distance needs and comes back down, so a search that moves
+//      d nodes ahead costs expected O(log d) instead of O(log n).
+//    - merge and intersect search with fingers, so when one list is much
+//      shorter (m items against n) they cost O(m log(n/m)), not O(n + m).
+//   -- Head:
+//    - head is a dummy node with a link for every level, its data is
+//      nullptr. If the list is empty, every link of head is nullptr.
+//   -- Insert Function:
+//    - Allocates memory for a Node, ptr to the data is passed in.
+//    - Allocating memory and setting data is the responsibility of the
+//      caller.
+//    - Duplicate data is allowed, a new item goes before equal items.
+//   -- Intersect Function:
+//    - At termination of the function, the two parameter lists are unchanged
+//      unless one is also the current object.
+//    - New memory is allocated if there is an intersection.
+//    - Gallops: whichever list is behind jumps ahead with a finger search
+//      to the other list's item, long runs with no match are skipped
+//      without being walked.
+//   -- Merge Function:
+//    - At termination of function, the two parameter lists are empty unless
+//      one is also the current object
+//    - Duplicate data is allowed
+//    - No new memory is allocated and nodes keep their heights.
+//    - The longer list stays linked as it is and the nodes of the shorter
+//      one are spliced in with finger searches. Equal items keep the
+//      firstList items ahead of the secondList ones.
+//----------------------------------------------------------------------------
+
+template <typename T>
+class SkipList {
+
+   // output operator for class SkipList, print data,
+   // responsibility for output is left to object stored in the list
+   friend ostream& operator<<(ostream& output, const SkipList<T>& thelist) {
+      typename SkipList<T>::Node* current = thelist.head->next[0];
+      while (current != nullptr) {
+         output << *current->data;
+         current = current->next[0];
+      }
+      return output;
+   }
+
+public:
+   SkipList();                               // default constructor
+   ~SkipList();                              // destructor
+   SkipList(const SkipList<T>&);             // copy constructor
+
+   // operator overloads
+   const SkipList<T>& operator=(const SkipList<T>&);
+   bool operator==(const SkipList<T>&) const;
+   bool operator!=(const SkipList<T>&) const;
+
+   void buildList(ifstream&);            // build a SkipList from datafile
+
+   void merge(SkipList<T>&, SkipList<T>&);
+   void intersect(const SkipList<T>&, const SkipList<T>&);
+
+   bool insert(T*);                      // insert one Node into SkipList
+   bool isEmpty() const;                 // is list empty?
+   bool retrieve(const T&, T*&) const;   // retrieves an item from the list
+   bool remove(const T&, T*&);           // removes an item from the list
+   void makeEmpty();                     // deletes the current list
+
+private:
+   static const int MAX_LEVEL = 16;      // enough for 4^16 items
+
+   struct Node {                 // a node, allocated with height links
+      T* data;                   // pointer to actual data, operations in T
+      int height;                // number of levels the node is on
+      Node* next[1];             // next node on each level, height entries
+   };
+
+   Node* head;                   // dummy node with MAX_LEVEL links
+   int level;                    // number of levels in use, at least 1
+   int count;                    // number of items in the list
+   unsigned int seed;            // state for randomHeight
+
+   static Node* newNode(T*, int);
+   static void freeNode(Node*);
+   int randomHeight();
+
+   // last node on each level whose data is less than target
+   void findLess(const T&, Node* []) const;
+
+   // moves a finger ahead to the last node on each level that goes before
+   // target, equal items go before it when the bool is true
+   void fingerSearch(const T&, Node* [], bool) const;
+   static bool goesBefore(const Node*, const T&, bool);
+   bool isAfter(const Node*, const Node*) const;
+
+   void copy(const SkipList<T>&);        // copies a list into an empty list
+   Node* detach();                       // unlinks every node, returns them
+
+   // appends node at the end of every level it is on, last holds the
+   // current last node of each level
+   void append(Node* [], Node*);
+   void finish(Node* []);                // ends every level after append
+};
+
+
+//----------------------------------------------------------------------------
+// newNode
+// allocates a node with room for height links, all of them nullptr
+template <typename T>
+typename SkipList<T>::Node* SkipList<T>::newNode(T* dataptr, int height) {
+   void* memory = ::operator new(sizeof(Node) + (height - 1) * sizeof(Node*));
+   Node* node = static_cast<Node*>(memory);
+   node->data = dataptr;
+   node->height = height;
+   for(int i = 0; i < height; i++) {
+      node->next[i] = nullptr;
+   }
+   return node;
+}
+
+//----------------------------------------------------------------------------
+// freeNode
+// reclaims the memory of a node, not of its data
+template <typename T>
+void SkipList<T>::freeNode(Node* node) {
+   ::operator delete(node);
+}
+
+//----------------------------------------------------------------------------
+// randomHeight
+// xorshift random bits, each pair of zero bits adds a level
+template <typename T>
+int SkipList<T>::randomHeight() {
+   seed ^= seed << 13;
+   seed ^= seed >> 17;
+   seed ^= seed << 5;
+   unsigned int bits = seed;
+   int height = 1;
+   while(height < MAX_LEVEL && (bits & 3) == 0) {
+      height++;
+      bits >>= 2;
+   }
+   return height;
+}
+
+//----------------------------------------------------------------------------
+// Constructor
+// an empty list is a head with every link nullptr
+template <typename T>
+SkipList<T>::SkipList() {
+   head = newNode(nullptr, MAX_LEVEL);
+   level = 1;
+   count = 0;
+   seed = 2463534242u;
+}
+
+//----------------------------------------------------------------------------
+// Copy Constructor
+// copies a list into the current list
+template <typename T>
+SkipList<T>::SkipList(const SkipList<T>& right) {
+   head = newNode(nullptr, MAX_LEVEL);
+   level = 1;
+   count = 0;
+   seed = 2463534242u;
+   copy(right);
+}
+
+//----------------------------------------------------------------------------
+// Destructor
+// empties a list and frees the head
+template <typename T>
+SkipList<T>::~SkipList() {
+   makeEmpty();
+   freeNode(head);
+}
+
+//----------------------------------------------------------------------------
+// operator=
+// copies a list into the current list
+template <typename T>
+const SkipList<T>& SkipList<T>::operator=(const SkipList<T>& right) {
+   if(this != &right) {          // if current list is same as argument
+      makeEmpty();
+      copy(right);
+   }
+   return *this;
+}
+
+//----------------------------------------------------------------------------
+// copy
+// copies the items of right in order, appending each one so no searching
+// is needed
+template <typename T>
+void SkipList<T>::copy(const SkipList<T>& right) {
+   Node* last[MAX_LEVEL];
+   for(int i = 0; i < MAX_LEVEL; i++) {
+      last[i] = head;
+   }
+   for(Node* current = right.head->next[0]; current != nullptr;
+                                            current = current->next[0]) {
+      append(last, newNode(new T(*current->data), randomHeight()));
+   }
+   finish(last);
+}
+
+//----------------------------------------------------------------------------
+// append
+// links node after the last node of each of its levels
+template <typename T>
+void SkipList<T>::append(Node* last[], Node* node) {
+   for(int i = 0; i < node->height; i++) {
+      last[i]->next[i] = node;
+      last[i] = node;
+   }
+   if(node->height > level) {
+      level = node->height;
+   }
+   count++;
+}
+
+//----------------------------------------------------------------------------
+// finish
+// the last node of each level links to nullptr
+template <typename T>
+void SkipList<T>::finish(Node* last[]) {
+   for(int i = 0; i < MAX_LEVEL; i++) {
+      last[i]->next[i] = nullptr;
+   }
+}
+
+//----------------------------------------------------------------------------
+// detach
+// returns the level 0 chain of nodes and leaves the list empty; the
+// nodes still have their old links on the upper levels
+template <typename T>
+typename SkipList<T>::Node* SkipList<T>::detach() {
+   Node* chain = head->next[0];
+   for(int i = 0; i < MAX_LEVEL; i++) {
+      head->next[i] = nullptr;
+   }
+   level = 1;
+   count = 0;
+   return chain;
+}
+
+//----------------------------------------------------------------------------
+// makeEmpty
+// empties the current object
+template <typename T>
+void SkipList<T>::makeEmpty() {
+   Node* current = detach();
+   while(current != nullptr) {
+      Node* next = current->next[0];
+      delete current->data;              // reclaim memory of data
+      freeNode(current);                 // reclaim memory of node
+      current = next;
+   }
+}
+
+//----------------------------------------------------------------------------
+// isEmpty
+// check to see if SkipList is empty as defined by a nullptr first link
+template <typename T>
+bool SkipList<T>::isEmpty() const {
+   return head->next[0] == nullptr;
+}
+
+//----------------------------------------------------------------------------
+// findLess
+// goes down from the top level, moving right while the next node is less
+// than target; before[i] is where the search left level i
+template <typename T>
+void SkipList<T>::findLess(const T& target, Node* before[]) const {
+   Node* current = head;
+   for(int i = level - 1; i >= 0; i--) {
+      while(current->next[i] != nullptr && *current->next[i]->data < target) {
+         current = current->next[i];
+      }
+      before[i] = current;
+   }
+}
+
+//----------------------------------------------------------------------------
+// goesBefore
+// whether node belongs ahead of target, equal items count as ahead when
+// afterEqual is true
+template <typename T>
+bool SkipList<T>::goesBefore(const Node* node, const T& target,
+                             bool afterEqual) {
+   if(node == nullptr) {
+      return false;
+   }
+   return afterEqual ? !(target < *node->data) : *node->data < target;
+}
+
+//----------------------------------------------------------------------------
+// isAfter
+// whether finger node a is not behind node b, both ahead of the same
+// target; head comes first. Equal items count as after, a finger sits on
+// or past any equal node the search reaches from the level above.
+template <typename T>
+bool SkipList<T>::isAfter(const Node* a, const Node* b) const {
+   if(a == head) {
+      return false;
+   }
+   return b == head || !(*a->data < *b->data);
+}
+
+//----------------------------------------------------------------------------
+// fingerSearch
+// finger holds the last node on each level ahead of an item no larger than
+// target. Climbs while the next node up the finger still goes ahead of
+// target, then comes down like findLess, starting each level from the
+// later of the finger and the node reached on the level above.
+template <typename T>
+void SkipList<T>::fingerSearch(const T& target, Node* finger[],
+                               bool afterEqual) const {
+   int top = 0;
+   while(top + 1 < level &&
+         goesBefore(finger[top + 1]->next[top + 1], target, afterEqual)) {
+      top++;
+   }
+   Node* current = finger[top];
+   for(int i = top; i >= 0; i--) {
+      if(isAfter(finger[i], current)) {
+         current = finger[i];
+      }
+      while(goesBefore(current->next[i], target, afterEqual)) {
+         current = current->next[i];
+      }
+      finger[i] = current;
+   }
+}
+
+//----------------------------------------------------------------------------
+// insert
+// insert an item into list; operator< of the T class
+// has the responsibility for the sorting criteria
+template <typename T>
+bool SkipList<T>::insert(T* dataptr) {
+   Node* before[MAX_LEVEL];
+   findLess(*dataptr, before);
+
+   int height = randomHeight();
+   for(int i = level; i < height; i++) {
+      before[i] = head;                  // new levels start at head
+   }
+   if(height > level) {
+      level = height;
+   }
+
+   Node* ptr = newNode(dataptr, height);
+   for(int i = 0; i < height; i++) {
+      ptr->next[i] = before[i]->next[i];
+      before[i]->next[i] = ptr;
+   }
+   count++;
+   return true;
+}
+
+//----------------------------------------------------------------------------
+// buildList
+// continually insert new items into the list
+template <typename T>
+void SkipList<T>::buildList(ifstream& infile) {
+   T* ptr;
+   bool successfulRead;                            // read good data
+   bool success = false;                           // successfully insert
+   for (;;) {
+      ptr = new T;
+      successfulRead = ptr->setData(infile);       // fill the T object
+      if (infile.eof()) {                          // reaches end of file
+         delete ptr;
+         ptr = nullptr;
+         break;
+      }
+
+      // insert good data into the list, otherwise ignore it
+      if (successfulRead) {
+         success = insert(ptr);
+      }
+      else {
+         delete ptr;
+         ptr = nullptr;
+      }
+      if (!success) break;
+   }
+}
+
+//----------------------------------------------------------------------------
+// operator==
+// finds if two lists hold equal items in the same order
+template <typename T>
+bool SkipList<T>::operator==(const SkipList<T>& right) const {
+   if(this == &right) {
+      return true;
+   }
+   Node* thisCurrent = head->next[0];
+   Node* rightCurrent = right.head->next[0];
+   while(thisCurrent != nullptr && rightCurrent != nullptr) {
+      if(*thisCurrent->data != *rightCurrent->data) {
+         return false;
+      }
+      thisCurrent = thisCurrent->next[0];
+      rightCurrent = rightCurrent->next[0];
+   }
+   return thisCurrent == nullptr && rightCurrent == nullptr;
+}
+
+//----------------------------------------------------------------------------
+// operator!=
+// utilizes definition of == to find if two lists are not equal
+template <typename T>
+bool SkipList<T>::operator!=(const SkipList<T>& right) const {
+   return !(*this == right);
+}
+
+//----------------------------------------------------------------------------
+// retrieve
+// finds the first item equal to target
+template <typename T>
+bool SkipList<T>::retrieve(const T& target, T*& p) const {
+   Node* before[MAX_LEVEL];
+   findLess(target, before);
+   Node* current = before[0]->next[0];
+   if(current != nullptr && *current->data == target) {
+      p = current->data;
+      return true;
+   }
+   return false;
+}
+
+//----------------------------------------------------------------------------
+// remove
+// unlinks the first item equal to target from every level it is on,
+// p is set to its data for the caller to reclaim
+template <typename T>
+bool SkipList<T>::remove(const T& target, T*& p) {
+   Node* before[MAX_LEVEL];
+   findLess(target, before);
+   Node* current = before[0]->next[0];
+   if(current == nullptr || *current->data != target) {
+      return false;
+   }
+   for(int i = 0; i < current->height; i++) {
+      before[i]->next[i] = current->next[i];
+   }
+   while(level > 1 && head->next[level - 1] == nullptr) {
+      level--;
+   }
+   p = current->data;
+   freeNode(current);
+   count--;
+   return true;
+}
+
+//----------------------------------------------------------------------------
+// merge
+// takes 2 sorted lists and merge into one long sorted list
+// At termination of function, the two parameter lists are empty unless one
+// is also the current object
+template <typename T>
+void SkipList<T>::merge(SkipList<T>& firstList, SkipList<T>& secondList) {
+   // if the calling object is the same as the two arguments
+   // e.g. company1.merge(company1, company1);
+   if(this == &firstList && this == &secondList) {
+      return;
+   }
+
+   // the longer list keeps its links, the shorter one is taken apart
+   bool firstIsBase = &firstList == &secondList ||
+                      firstList.count >= secondList.count;
+   SkipList<T>& base = firstIsBase ? firstList : secondList;
+   SkipList<T>& other = firstIsBase ? secondList : firstList;
+   Node* chain = (&other != &base) ? other.detach() : nullptr;
+
+   // move the nodes of base into the current list, which may be either one
+   if(this != &base) {
+      makeEmpty();
+      swap(head, base.head);
+      swap(level, base.level);
+      swap(count, base.count);
+   }
+
+   // secondList items go after equal firstList items and the reverse
+   Node* finger[MAX_LEVEL];
+   for(int i = 0; i < MAX_LEVEL; i++) {
+      finger[i] = head;
+   }
+   while(chain != nullptr) {
+      Node* node = chain;
+      chain = chain->next[0];
+      fingerSearch(*node->data, finger, firstIsBase);
+      for(int i = 0; i < node->height; i++) {
+         node->next[i] = finger[i]->next[i];
+         finger[i]->next[i] = node;
+         finger[i] = node;
+      }
+      if(node->height > level) {
+         level = node->height;
+      }
+      count++;
+   }
+}
+
+//----------------------------------------------------------------------------
+// intersect
+// takes two sorted lists and finds the items in common in both lists
+// at termination of the function, the two parameter lists are unchanged
+// unless one is also the current object
+template <typename T>
+void SkipList<T>::intersect(const SkipList<T>& firstList,
+                            const SkipList<T>& secondList) {
+   // if the calling object is the same as the two arguments
+   // e.g. company1.intersect(company1, company1);
+   if(this == &firstList && this == &secondList) {
+      return;
+   }
+
+   // build the result in a separate list, the current list may be one of
+   // the parameters
+   SkipList<T> result;
+   Node* last[MAX_LEVEL];
+   Node* firstFinger[MAX_LEVEL];
+   Node* secondFinger[MAX_LEVEL];
+   for(int i = 0; i < MAX_LEVEL; i++) {
+      last[i] = result.head;
+      firstFinger[i] = firstList.head;
+      secondFinger[i] = secondList.head;
+   }
+
+   // the list that is behind jumps to the other one's item
+   Node* firstCurrent = firstList.head->next[0];
+   Node* secondCurrent = secondList.head->next[0];
+   while(firstCurrent != nullptr && secondCurrent != nullptr) {
+      if(*firstCurrent->data < *secondCurrent->data) {
+         firstList.fingerSearch(*secondCurrent->data, firstFinger, false);
+         firstCurrent = firstFinger[0]->next[0];
+      }
+      else if(*firstCurrent->data == *secondCurrent->data) {
+         result.append(last, newNode(new T(*firstCurrent->data),
+                                     result.randomHeight()));
+         firstCurrent = firstCurrent->next[0];
+         secondCurrent = secondCurrent->next[0];
+      }
+      else {
+         secondList.fingerSearch(*firstCurrent->data, secondFinger, false);
+         secondCurrent = secondFinger[0]->next[0];
+      }
+   }
+   result.finish(last);
+
+   // hand the result's nodes over to the current list
+   makeEmpty();
+   swap(head, result.head);
+   swap(level, result.level);
+   swap(count, result.count);
+}
+
+#endif
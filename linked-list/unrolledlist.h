@@ -0,0 +1,502 @@
+//////////////////////////////  unrolledlist.h file  /////////////////////////
+// Sorted unrolled linked list, same interface as List in list.h
+
+#ifndef UNROLLEDLIST_H
+#define UNROLLEDLIST_H
+
+#include <iostream>
+#include <fstream>
+#include <utility>
+using namespace std;
+
+//--------------------------  class UnrolledList  ----------------------------
+// ADT UnrolledList: Finite, ordered collection of zero or more items.
+//           The ordering is determined by operator< of T class.
+//           Ability to find union of two lists
+//           Ability to find intersection of two lists
+//           Ability to retrieve data from a list
+//           Ability to remove data from a list
+//
+// Assumptions and Implementation:
+//   -- Control of <, printing, etc. of T information is in the T class.
+//   -- T needs a default constructor and move assignment.
+//   -- Nodes:
+//    - Every node holds up to CAPACITY items by value, in sorted order,
+//      sized so a node spans a couple of cache lines. Scans go through
+//      the items of a node like an array instead of following a node
+//      pointer and then a data pointer for each item.
+//    - Searching compares only the last item of each node until it finds
+//      the node the item belongs in.
+//    - A full node is split in half to make room; a node that drops below
+//      half full is merged with the next node when both fit in one, and
+//      an empty node is unlinked.
+//   -- Head:
+//    - head points to first node, nullptr if the list is empty.
+//   -- Insert Function:
+//    - The item is moved into the list and the pointer passed in is
+//      deleted, the caller allocates it as with List.
+//    - Duplicate data is allowed, a new item goes before equal items.
+//   -- Retrieve Function:
+//    - The pointer returned points into a node, it is valid until the
+//      list is changed.
+//   -- Remove Function:
+//    - The removed item is moved into newly allocated memory, so the
+//      caller deletes it as with List.
+//   -- Intersect Function:
+//    - At termination of the function, the two parameter lists are unchanged
+//      unless one is also the current object.
+//    - New memory is allocated if there is an intersection.
+//   -- Merge Function:
+//    - At termination of function, the two parameter lists are empty unless
+//      one is also the current object
+//    - Duplicate data is allowed
+//    - Items are moved, not copied, into full nodes; each old node is freed
+//      as soon as its items are used up.
+//----------------------------------------------------------------------------
+
+template <typename T>
+class UnrolledList {
+
+   // output operator for class UnrolledList, print data,
+   // responsibility for output is left to object stored in the list
+   friend ostream& operator<<(ostream& output,
+                              const UnrolledList<T>& thelist) {
+      typename UnrolledList<T>::Node* current = thelist.head;
+      while (current != nullptr) {
+         for (int i = 0; i < current->count; i++) {
+            output << current->items[i];
+         }
+         current = current->next;
+      }
+      return output;
+   }
+
+public:
+   UnrolledList();                           // default constructor
+   ~UnrolledList();                          // destructor
+   UnrolledList(const UnrolledList<T>&);     // copy constructor
+
+   // operator overloads
+   const UnrolledList<T>& operator=(const UnrolledList<T>&);
+   bool operator==(const UnrolledList<T>&) const;
+   bool operator!=(const UnrolledList<T>&) const;
+
+   void buildList(ifstream&);            // build an UnrolledList from file
+
+   void merge(UnrolledList<T>&, UnrolledList<T>&);
+   void intersect(const UnrolledList<T>&, const UnrolledList<T>&);
+
+   bool insert(T*);                      // insert one item into the list
+   bool isEmpty() const;                 // is list empty?
+   bool retrieve(const T&, T*&) const;   // retrieves an item from the list
+   bool remove(const T&, T*&);           // removes an item from the list
+   void makeEmpty();                     // deletes the current list
+
+private:
+   // items per node: about 256 bytes of items, at least 4
+   static const int CAPACITY = (256 / sizeof(T) > 4) ? 256 / sizeof(T) : 4;
+
+   struct Node {                 // a node holding a run of sorted items
+      Node* next;
+      int count;                 // items in use, items[0 .. count-1]
+      T items[CAPACITY];
+   };
+
+   Node* head;                   // pointer to first node in list
+
+   void insertItem(T&&);                 // moves one item into the list
+   void copy(const UnrolledList<T>&);    // copies a list into an empty list
+
+   // moves item to the end of the chain ending at tail, adding a node when
+   // tail is full
+   static void append(Node*&, Node*&, T&&);
+};
+
+
+//----------------------------------------------------------------------------
+// Constructor
+// deafults the head to a nullptr
+template <typename T>
+UnrolledList<T>::UnrolledList() {
+   head = nullptr;
+}
+
+//----------------------------------------------------------------------------
+// Copy Constructor
+// copies a list into the current list
+template <typename T>
+UnrolledList<T>::UnrolledList(const UnrolledList<T>& right) {
+   head = nullptr;
+   copy(right);
+}
+
+//----------------------------------------------------------------------------
+// Destructor
+// empties a list
+template <typename T>
+UnrolledList<T>::~UnrolledList() {
+   makeEmpty();
+}
+
+//----------------------------------------------------------------------------
+// operator=
+// copies a list into the current list
+template <typename T>
+const UnrolledList<T>& UnrolledList<T>::operator=(
+                                            const UnrolledList<T>& right) {
+   if(this != &right) {          // if current list is same as argument
+      makeEmpty();
+      copy(right);
+   }
+   return *this;
+}
+
+//----------------------------------------------------------------------------
+// copy
+// copies right node by node, so the copy has the same layout
+template <typename T>
+void UnrolledList<T>::copy(const UnrolledList<T>& right) {
+   Node** link = &head;
+   for(Node* current = right.head; current != nullptr;
+                                   current = current->next) {
+      *link = new Node(*current);
+      link = &(*link)->next;
+   }
+   *link = nullptr;
+}
+
+//----------------------------------------------------------------------------
+// makeEmpty
+// empties the current object
+template <typename T>
+void UnrolledList<T>::makeEmpty() {
+   while(head != nullptr) {
+      Node* next = head->next;
+      delete head;                       // items go with the node
+      head = next;
+   }
+}
+
+//----------------------------------------------------------------------------
+// isEmpty
+// check to see if the list is empty as defined by a nullptr head
+template <typename T>
+bool UnrolledList<T>::isEmpty() const {
+   return head == nullptr;
+}
+
+//----------------------------------------------------------------------------
+// insert
+// moves the item into the list and deletes dataptr; operator< of the T
+// class has the responsibility for the sorting criteria
+template <typename T>
+bool UnrolledList<T>::insert(T* dataptr) {
+   insertItem(std::move(*dataptr));
+   delete dataptr;
+   return true;
+}
+
+//----------------------------------------------------------------------------
+// insertItem
+// the item goes in the first node whose last item is not less than it, or
+// the last node; a full node is split in half first
+template <typename T>
+void UnrolledList<T>::insertItem(T&& item) {
+   if(head == nullptr) {
+      head = new Node;
+      head->next = nullptr;
+      head->count = 0;
+   }
+   Node* current = head;
+   while(current->next != nullptr &&
+         current->items[current->count - 1] < item) {
+      current = current->next;
+   }
+
+   if(current->count == CAPACITY) {
+      // the upper half moves to a new node after current
+      Node* upper = new Node;
+      int half = CAPACITY / 2;
+      for(int i = half; i < CAPACITY; i++) {
+         upper->items[i - half] = std::move(current->items[i]);
+      }
+      upper->count = CAPACITY - half;
+      current->count = half;
+      upper->next = current->next;
+      current->next = upper;
+      if(current->items[half - 1] < item) {
+         current = upper;
+      }
+   }
+
+   // shift the items not less than the new one, so it goes before equal
+   // items as in List
+   int i = current->count;
+   while(i > 0 && !(current->items[i - 1] < item)) {
+      current->items[i] = std::move(current->items[i - 1]);
+      i--;
+   }
+   current->items[i] = std::move(item);
+   current->count++;
+}
+
+//----------------------------------------------------------------------------
+// buildList
+// continually insert new items into the list
+template <typename T>
+void UnrolledList<T>::buildList(ifstream& infile) {
+   for (;;) {
+      T item;
+      bool successfulRead = item.setData(infile);  // fill the T object
+      if (infile.eof()) {                          // reaches end of file
+         break;
+      }
+
+      // insert good data into the list, otherwise ignore it
+      if (successfulRead) {
+         insertItem(std::move(item));
+      }
+   }
+}
+
+//----------------------------------------------------------------------------
+// operator==
+// finds if two lists hold equal items in the same order, the node layouts
+// may differ
+template <typename T>
+bool UnrolledList<T>::operator==(const UnrolledList<T>& right) const {
+   if(this == &right) {
+      return true;
+   }
+   Node* thisCurrent = head;
+   Node* rightCurrent = right.head;
+   int thisIndex = 0;
+   int rightIndex = 0;
+   for(;;) {
+      // step over finished nodes
+      while(thisCurrent != nullptr && thisIndex == thisCurrent->count) {
+         thisCurrent = thisCurrent->next;
+         thisIndex = 0;
+      }
+      while(rightCurrent != nullptr && rightIndex == rightCurrent->count) {
+         rightCurrent = rightCurrent->next;
+         rightIndex = 0;
+      }
+      if(thisCurrent == nullptr || rightCurrent == nullptr) {
+         return thisCurrent == nullptr && rightCurrent == nullptr;
+      }
+      if(thisCurrent->items[thisIndex] != rightCurrent->items[rightIndex]) {
+         return false;
+      }
+      thisIndex++;
+      rightIndex++;
+   }
+}
+
+//----------------------------------------------------------------------------
+// operator!=
+// utilizes definition of == to find if two lists are not equal
+template <typename T>
+bool UnrolledList<T>::operator!=(const UnrolledList<T>& right) const {
+   return !(*this == right);
+}
+
+//----------------------------------------------------------------------------
+// retrieve
+// finds the first item equal to target, p points to it inside its node
+template <typename T>
+bool UnrolledList<T>::retrieve(const T& target, T*& p) const {
+   Node* current = head;
+   while(current != nullptr && current->items[current->count - 1] < target) {
+      current = current->next;
+   }
+   if(current == nullptr) {
+      return false;
+   }
+   for(int i = 0; i < current->count; i++) {
+      if(current->items[i] == target) {
+         p = &current->items[i];
+         return true;
+      }
+      if(target < current->items[i]) {
+         break;
+      }
+   }
+   return false;
+}
+
+//----------------------------------------------------------------------------
+// remove
+// takes the first item equal to target out of its node; p points to a new
+// copy of it for the caller to reclaim
+template <typename T>
+bool UnrolledList<T>::remove(const T& target, T*& p) {
+   Node* previous = nullptr;
+   Node* current = head;
+   while(current != nullptr && current->items[current->count - 1] < target) {
+      previous = current;
+      current = current->next;
+   }
+   if(current == nullptr) {
+      return false;
+   }
+   int i = 0;
+   while(i < current->count && current->items[i] < target) {
+      i++;
+   }
+   if(i == current->count || current->items[i] != target) {
+      return false;
+   }
+
+   p = new T(std::move(current->items[i]));
+   for(; i < current->count - 1; i++) {
+      current->items[i] = std::move(current->items[i + 1]);
+   }
+   current->count--;
+
+   Node* next = current->next;
+   if(current->count == 0) {
+      // unlink the empty node
+      if(previous == nullptr) {
+         head = next;
+      }
+      else {
+         previous->next = next;
+      }
+      delete current;
+   }
+   else if(current->count < CAPACITY / 2 && next != nullptr &&
+           current->count + next->count <= CAPACITY) {
+      // fold the next node into this one
+      for(int j = 0; j < next->count; j++) {
+         current->items[current->count + j] = std::move(next->items[j]);
+      }
+      current->count += next->count;
+      current->next = next->next;
+      delete next;
+   }
+   return true;
+}
+
+//----------------------------------------------------------------------------
+// append
+// moves item to the end of the chain; tail is the last node of the chain
+// and chainHead its first, both nullptr for an empty chain
+template <typename T>
+void UnrolledList<T>::append(Node*& chainHead, Node*& tail, T&& item) {
+   if(tail == nullptr || tail->count == CAPACITY) {
+      Node* node = new Node;
+      node->next = nullptr;
+      node->count = 0;
+      if(tail == nullptr) {
+         chainHead = node;
+      }
+      else {
+         tail->next = node;
+      }
+      tail = node;
+   }
+   tail->items[tail->count] = std::move(item);
+   tail->count++;
+}
+
+//----------------------------------------------------------------------------
+// merge
+// takes 2 sorted lists and merge into one long sorted list
+// At termination of function, the two parameter lists are empty unless one
+// is also the current object
+template <typename T>
+void UnrolledList<T>::merge(UnrolledList<T>& firstList,
+                            UnrolledList<T>& secondList) {
+   // if the calling object is the same as the two arguments
+   // e.g. company1.merge(company1, company1);
+   if(this == &firstList && this == &secondList) {
+      return;
+   }
+
+   // take the nodes of both lists before emptying the current list, which
+   // may be one of them
+   Node* firstCurrent = firstList.head;
+   firstList.head = nullptr;
+   Node* secondCurrent = nullptr;
+   if(&secondList != &firstList) {
+      secondCurrent = secondList.head;
+      secondList.head = nullptr;
+   }
+   makeEmpty();
+
+   Node* tail = nullptr;
+   int firstIndex = 0;
+   int secondIndex = 0;
+   while(firstCurrent != nullptr || secondCurrent != nullptr) {
+      bool takeFirst = secondCurrent == nullptr ||
+                       (firstCurrent != nullptr &&
+                        firstCurrent->items[firstIndex] <=
+                        secondCurrent->items[secondIndex]);
+      if(takeFirst) {
+         append(head, tail, std::move(firstCurrent->items[firstIndex]));
+         if(++firstIndex == firstCurrent->count) {
+            Node* used = firstCurrent;
+            firstCurrent = firstCurrent->next;
+            firstIndex = 0;
+            delete used;
+         }
+      }
+      else {
+         append(head, tail, std::move(secondCurrent->items[secondIndex]));
+         if(++secondIndex == secondCurrent->count) {
+            Node* used = secondCurrent;
+            secondCurrent = secondCurrent->next;
+            secondIndex = 0;
+            delete used;
+         }
+      }
+   }
+}
+
+//----------------------------------------------------------------------------
+// intersect
+// takes two sorted lists and finds the items in common in both lists
+// at termination of the function, the two parameter lists are unchanged
+// unless one is also the current object
+template <typename T>
+void UnrolledList<T>::intersect(const UnrolledList<T>& firstList,
+                                const UnrolledList<T>& secondList) {
+   // if the calling object is the same as the two arguments
+   // e.g. company1.intersect(company1, company1);
+   if(this == &firstList && this == &secondList) {
+      return;
+   }
+
+   // build the result in a separate chain, the current list may be one of
+   // the parameters
+   Node* resultHead = nullptr;
+   Node* tail = nullptr;
+   Node* firstCurrent = firstList.head;
+   Node* secondCurrent = secondList.head;
+   int firstIndex = 0;
+   int secondIndex = 0;
+   while(firstCurrent != nullptr && secondCurrent != nullptr) {
+      const T& firstItem = firstCurrent->items[firstIndex];
+      const T& secondItem = secondCurrent->items[secondIndex];
+      bool advanceFirst = !(secondItem < firstItem);
+      bool advanceSecond = !(firstItem < secondItem);
+      if(advanceFirst && advanceSecond) {
+         append(resultHead, tail, T(firstItem));
+      }
+      if(advanceFirst && ++firstIndex == firstCurrent->count) {
+         firstCurrent = firstCurrent->next;
+         firstIndex = 0;
+      }
+      if(advanceSecond && ++secondIndex == secondCurrent->count) {
+         secondCurrent = secondCurrent->next;
+         secondIndex = 0;
+      }
+   }
+
+   // make the current list empty and attach the result
+   makeEmpty();
+   head = resultHead;
+}
+
+#endif